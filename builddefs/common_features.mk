@@ -187,12 +187,12 @@ else
     # External I2C EEPROM implementation
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_I2C
     I2C_DRIVER_REQUIRED = yes
-    SRC += eeprom_driver.c eeprom_i2c.c
+    SRC += eeprom_driver.c eeprom_write_back.c eeprom_i2c.c
   else ifeq ($(strip $(EEPROM_DRIVER)), spi)
     # External SPI EEPROM implementation
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_SPI
     SPI_DRIVER_REQUIRED = yes
-    SRC += eeprom_driver.c eeprom_spi.c
+    SRC += eeprom_driver.c eeprom_write_back.c eeprom_spi.c
   else ifeq ($(strip $(EEPROM_DRIVER)), legacy_stm32_flash)
     # STM32 Emulated EEPROM, backed by MCU flash (soon to be deprecated)
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_LEGACY_EMULATED_FLASH
@@ -250,6 +250,13 @@ else
   endif
 endif
 
+ifeq ($(strip $(EEPROM_WRITE_BACK_ENABLE)), yes)
+  ifeq ($(filter $(EEPROM_DRIVER),i2c spi),)
+    $(call CATASTROPHIC_ERROR,Invalid EEPROM_DRIVER,EEPROM_WRITE_BACK_ENABLE requires EEPROM_DRIVER to be i2c or spi)
+  endif
+  OPT_DEFS += -DEEPROM_WRITE_BACK_ENABLE
+endif
+
 VALID_WEAR_LEVELING_DRIVER_TYPES := custom embedded_flash spi_flash rp2040_flash legacy
 WEAR_LEVELING_DRIVER ?= none
 ifneq ($(strip $(WEAR_LEVELING_DRIVER)),none)
@@ -677,7 +684,11 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
         endif
 
         OPT_DEFS += -DSERIAL_DRIVER_$(strip $(shell echo $(SERIAL_DRIVER) | tr '[:lower:]' '[:upper:]'))
-        ifeq ($(strip $(SERIAL_DRIVER)), bitbang)
+        ifeq ($(PLATFORM),TEST)
+            # The unit test harness simulates the other half in-process
+            COMMON_VPATH += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)
+            SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)/serial_loopback.c
+        else ifeq ($(strip $(SERIAL_DRIVER)), bitbang)
             QUANTUM_LIB_SRC += serial.c
         else
             QUANTUM_LIB_SRC += serial_protocol.c
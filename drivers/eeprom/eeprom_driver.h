@@ -16,7 +16,43 @@
 
 #pragma once
 
+#include <stdbool.h>
+
 #include "eeprom.h"
 
 void eeprom_driver_init(void);
 void eeprom_driver_erase(void);
+
+/**
+ * Raw block accessors of the page based external EEPROM drivers (i2c, spi).
+ * eeprom_read_block() and eeprom_write_block() are provided on top of them by
+ * eeprom_write_back.c.
+ */
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len);
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len);
+
+/**
+ * Whether the device is still programming the last page written. Writes
+ * return as soon as the data has been transferred, and accesses wait for the
+ * write cycle to complete -- polling this first avoids doing so.
+ */
+bool eeprom_driver_busy(void);
+
+#ifdef EEPROM_WRITE_BACK_ENABLE
+/**
+ * Program every page with pending writes to the device.
+ */
+void eeprom_write_back_flush(void);
+
+/**
+ * Whether any writes are still held in RAM.
+ */
+bool eeprom_write_back_pending(void);
+
+/**
+ * Start programming the oldest pending page if the device is idle, and either
+ * no writes happened for EEPROM_WRITE_BACK_IDLE_TIMEOUT milliseconds or all
+ * lines are in use.
+ */
+void eeprom_write_back_task(void);
+#endif // EEPROM_WRITE_BACK_ENABLE
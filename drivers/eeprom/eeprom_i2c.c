@@ -33,18 +33,21 @@
     there is nothing to override during linkage.
 */
 
-#include "wait.h"
+#include "timer.h"
 #include "i2c_master.h"
-#include "eeprom.h"
+#include "eeprom_driver.h"
 #include "eeprom_i2c.h"
 
 // #define DEBUG_EEPROM_OUTPUT
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-#    include "timer.h"
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
+static bool      write_cycle_active = false;
+static uint16_t  write_cycle_start;
+static uintptr_t write_cycle_addr;
+
 static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     uintptr_t p = (uintptr_t)addr;
     for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
@@ -53,6 +56,21 @@ static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     }
 }
 
+bool eeprom_driver_busy(void) {
+    if (write_cycle_active) {
+        // ACK polling -- the device doesn't acknowledge its address until the internal write cycle has completed
+        if (timer_elapsed(write_cycle_start) > EXTERNAL_EEPROM_WRITE_TIME || i2c_ping_address(EXTERNAL_EEPROM_I2C_ADDRESS(write_cycle_addr), 100) == I2C_STATUS_SUCCESS) {
+            write_cycle_active = false;
+        }
+    }
+    return write_cycle_active;
+}
+
+static void i2c_eeprom_wait_while_busy(void) {
+    while (eeprom_driver_busy()) {
+    }
+}
+
 void eeprom_driver_init(void) {
     i2c_init();
 #if defined(EXTERNAL_EEPROM_WP_PIN)
@@ -78,10 +96,12 @@ void eeprom_driver_erase(void) {
 #endif
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len) {
     uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
     fill_target_address(complete_packet, addr);
 
+    i2c_eeprom_wait_while_busy();
+
     i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
     i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
 
@@ -94,7 +114,7 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 #endif // DEBUG_EEPROM_OUTPUT
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
     uint8_t   complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
     uint8_t * read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
@@ -124,8 +144,13 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         dprintf("\n");
 #endif // DEBUG_EEPROM_OUTPUT
 
+        i2c_eeprom_wait_while_busy();
         i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
-        wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
+
+        // Completion is only awaited before the next access to the device
+        write_cycle_active = true;
+        write_cycle_start  = timer_read();
+        write_cycle_addr   = target_addr;
 
         read_buf += write_length;
         target_addr += write_length;
@@ -133,6 +158,8 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     }
 
 #if defined(EXTERNAL_EEPROM_WP_PIN)
+    /* Write protection must not be restored before the last page has been programmed */
+    i2c_eeprom_wait_while_busy();
     /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
     gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
@@ -34,7 +34,7 @@
 #include "debug.h"
 #include "timer.h"
 #include "spi_master.h"
-#include "eeprom.h"
+#include "eeprom_driver.h"
 #include "eeprom_spi.h"
 
 #define CMD_WREN 6
@@ -52,6 +52,8 @@
 #    define EXTERNAL_EEPROM_SPI_TIMEOUT 100
 #endif
 
+static bool write_cycle_active = false;
+
 static bool spi_eeprom_start(void) {
     return spi_start(EXTERNAL_EEPROM_SPI_SLAVE_SELECT_PIN, EXTERNAL_EEPROM_SPI_LSBFIRST, EXTERNAL_EEPROM_SPI_MODE, EXTERNAL_EEPROM_SPI_CLOCK_DIVISOR);
 }
@@ -88,6 +90,20 @@ static void spi_eeprom_transmit_address(uintptr_t addr) {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+bool eeprom_driver_busy(void) {
+    if (write_cycle_active) {
+        // A single status register read, the bus may just as well be in use by another device
+        if (!spi_eeprom_start()) {
+            return true;
+        }
+
+        spi_write(CMD_RDSR);
+        write_cycle_active = spi_read() & SR_WIP;
+        spi_stop();
+    }
+    return write_cycle_active;
+}
+
 void eeprom_driver_init(void) {
     spi_init();
 }
@@ -108,7 +124,7 @@ void eeprom_driver_erase(void) {
 #endif
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len) {
     //-------------------------------------------------
     // Wait for the write-in-progress bit to be cleared
     spi_status_t response = spi_eeprom_wait_while_busy(EXTERNAL_EEPROM_SPI_TIMEOUT);
@@ -144,7 +160,7 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     spi_stop();
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
     bool      res;
     uint8_t * read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
@@ -198,6 +214,7 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         spi_eeprom_transmit_address(target_addr);
         spi_transmit(read_buf, write_length);
         spi_stop();
+        write_cycle_active = true;
 
         read_buf += write_length;
         target_addr += write_length;
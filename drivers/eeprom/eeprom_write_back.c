@@ -0,0 +1,232 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdint.h>
+#include <string.h>
+
+#include "eeprom_driver.h"
+
+/*
+    Sits between the generic eeprom_XXXX_YYYY helpers and the page based
+    external EEPROM drivers, which only provide eeprom_driver_read_block() and
+    eeprom_driver_write_block().
+
+    Without EEPROM_WRITE_BACK_ENABLE, accesses are passed straight through.
+    Otherwise writes are collected per device page in RAM, and each page is
+    programmed once with the merged dirty range -- either when the line is
+    needed for another page, after EEPROM_WRITE_BACK_IDLE_TIMEOUT without
+    further writes, or on an explicit eeprom_write_back_flush(). Pages are
+    only handed to the device by eeprom_write_back_task() while it's idle, so
+    the keyboard doesn't wait for write cycles to complete.
+*/
+
+#ifdef EEPROM_WRITE_BACK_ENABLE
+
+#    include "timer.h"
+
+#    if defined(EEPROM_I2C)
+#        include "eeprom_i2c.h"
+#    elif defined(EEPROM_SPI)
+#        include "eeprom_spi.h"
+#    endif
+
+#    ifndef EEPROM_WRITE_BACK_PAGE_SIZE
+#        ifdef EXTERNAL_EEPROM_PAGE_SIZE
+#            define EEPROM_WRITE_BACK_PAGE_SIZE EXTERNAL_EEPROM_PAGE_SIZE
+#        else
+#            define EEPROM_WRITE_BACK_PAGE_SIZE 32
+#        endif
+#    endif
+
+#    ifndef EEPROM_WRITE_BACK_LINES
+#        define EEPROM_WRITE_BACK_LINES 4
+#    endif
+
+#    ifndef EEPROM_WRITE_BACK_IDLE_TIMEOUT
+#        define EEPROM_WRITE_BACK_IDLE_TIMEOUT 250
+#    endif
+
+_Static_assert(EEPROM_WRITE_BACK_LINES > 0, "EEPROM_WRITE_BACK_LINES must be at least 1");
+_Static_assert(EEPROM_WRITE_BACK_PAGE_SIZE <= UINT16_MAX, "EEPROM_WRITE_BACK_PAGE_SIZE must fit in 16 bits");
+
+typedef struct eeprom_write_back_line_t {
+    uintptr_t page;     // Device address of the first byte of the page
+    uint32_t  sequence; // Order in which lines were dirtied, oldest is flushed first
+    uint16_t  start;    // Dirty range within the page, empty when start == end
+    uint16_t  end;
+    uint8_t   data[EEPROM_WRITE_BACK_PAGE_SIZE];
+} eeprom_write_back_line_t;
+
+static eeprom_write_back_line_t lines[EEPROM_WRITE_BACK_LINES];
+static uint32_t                 sequence;
+static uint32_t                 last_write;
+
+static inline bool line_dirty(const eeprom_write_back_line_t *line) {
+    return line->end > line->start;
+}
+
+static void line_flush(eeprom_write_back_line_t *line) {
+    if (line_dirty(line)) {
+        eeprom_driver_write_block(&line->data[line->start], (void *)(line->page + line->start), line->end - line->start);
+        line->start = line->end = 0;
+    }
+}
+
+/**
+ * @brief The dirty line which has been waiting the longest, or NULL if all lines are clean.
+ */
+static eeprom_write_back_line_t *line_oldest(void) {
+    eeprom_write_back_line_t *oldest = NULL;
+    for (int i = 0; i < EEPROM_WRITE_BACK_LINES; ++i) {
+        if (line_dirty(&lines[i]) && (!oldest || lines[i].sequence < oldest->sequence)) {
+            oldest = &lines[i];
+        }
+    }
+    return oldest;
+}
+
+static bool line_free(void) {
+    for (int i = 0; i < EEPROM_WRITE_BACK_LINES; ++i) {
+        if (!line_dirty(&lines[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Look up the line holding pending writes to the page, claiming a new
+ * one if there is none -- which flushes the oldest line if all are in use.
+ */
+static eeprom_write_back_line_t *line_get(uintptr_t page, uint16_t offset) {
+    eeprom_write_back_line_t *line = NULL;
+    for (int i = 0; i < EEPROM_WRITE_BACK_LINES; ++i) {
+        if (line_dirty(&lines[i])) {
+            if (lines[i].page == page) {
+                return &lines[i];
+            }
+        } else if (!line) {
+            line = &lines[i];
+        }
+    }
+
+    if (!line) {
+        line = line_oldest();
+        line_flush(line);
+    }
+
+    line->page     = page;
+    line->sequence = ++sequence;
+    line->start    = offset;
+    line->end      = offset;
+    return line;
+}
+
+void eeprom_write_back_flush(void) {
+    for (int i = 0; i < EEPROM_WRITE_BACK_LINES; ++i) {
+        line_flush(&lines[i]);
+    }
+}
+
+bool eeprom_write_back_pending(void) {
+    return line_oldest() != NULL;
+}
+
+void eeprom_write_back_task(void) {
+    eeprom_write_back_line_t *line = line_oldest();
+    if (!line || eeprom_driver_busy()) {
+        return;
+    }
+
+    // A single page per scan, whose write cycle then completes in the background. Lines are freed up early once all
+    // of them are in use, so that bulk updates rarely have to wait for an eviction.
+    if (timer_elapsed32(last_write) >= EEPROM_WRITE_BACK_IDLE_TIMEOUT || !line_free()) {
+        line_flush(line);
+    }
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    uintptr_t first = (uintptr_t)addr;
+    uintptr_t last  = first + len;
+
+    for (int i = 0; i < EEPROM_WRITE_BACK_LINES; ++i) {
+        eeprom_write_back_line_t *line = &lines[i];
+        if (line_dirty(line) && line->page + line->start <= first && last <= line->page + line->end) {
+            memcpy(buf, &line->data[first - line->page], len);
+            return;
+        }
+    }
+
+    eeprom_driver_read_block(buf, addr, len);
+
+    // Overlay whatever hasn't made it to the device yet
+    for (int i = 0; i < EEPROM_WRITE_BACK_LINES; ++i) {
+        eeprom_write_back_line_t *line = &lines[i];
+        if (!line_dirty(line)) {
+            continue;
+        }
+        uintptr_t start = line->page + line->start;
+        uintptr_t end   = line->page + line->end;
+        if (start < first) {
+            start = first;
+        }
+        if (end > last) {
+            end = last;
+        }
+        if (start < end) {
+            memcpy((uint8_t *)buf + (start - first), &line->data[start - line->page], end - start);
+        }
+    }
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *source      = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
+
+    while (len > 0) {
+        uint16_t  offset = target_addr % EEPROM_WRITE_BACK_PAGE_SIZE;
+        uintptr_t page   = target_addr - offset;
+        uint16_t  length = EEPROM_WRITE_BACK_PAGE_SIZE - offset;
+        if (length > len) {
+            length = len;
+        }
+
+        eeprom_write_back_line_t *line = line_get(page, offset);
+
+        // The merged range is written in one go, so any gap to the existing range is filled from the device
+        if (offset > line->end) {
+            eeprom_driver_read_block(&line->data[line->end], (const void *)(page + line->end), offset - line->end);
+            line->end = offset;
+        }
+        if (offset + length < line->start) {
+            eeprom_driver_read_block(&line->data[offset + length], (const void *)(page + offset + length), line->start - (offset + length));
+            line->start = offset + length;
+        }
+
+        memcpy(&line->data[offset], source, length);
+        if (offset < line->start) {
+            line->start = offset;
+        }
+        if (offset + length > line->end) {
+            line->end = offset + length;
+        }
+
+        source += length;
+        target_addr += length;
+        len -= length;
+    }
+
+    last_write = timer_read32();
+}
+
+#else
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_driver_read_block(buf, addr, len);
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    eeprom_driver_write_block(buf, addr, len);
+}
+
+#endif // EEPROM_WRITE_BACK_ENABLE
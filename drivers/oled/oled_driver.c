@@ -100,6 +100,24 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef OLED_BLOCK_SIZE
 #    define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT)
 #endif
+// Data is sent in the background where the SPI driver supports it
+#if defined(OLED_TRANSPORT_SPI) && defined(PROTOCOL_CHIBIOS)
+#    define OLED_ASYNC_TRANSFER
+#endif
+// With the buffer kept in display layout, it never needs rotating on its way to the display
+#ifdef OLED_NATIVE_ROTATION
+#    define OLED_RENDER_ROTATED false
+#else
+#    define OLED_RENDER_ROTATED HAS_FLAGS(oled_rotation, OLED_ROTATION_90)
+#endif
+// Maximum number of contiguous dirty blocks sent as a single transfer
+#ifndef OLED_UPDATE_BURST_LIMIT
+#    ifdef OLED_ASYNC_TRANSFER
+#        define OLED_UPDATE_BURST_LIMIT OLED_BLOCK_COUNT
+#    else
+#        define OLED_UPDATE_BURST_LIMIT 1
+#    endif
+#endif
 // Default display clock
 #if !defined(OLED_DISPLAY_CLOCK)
 #    define OLED_DISPLAY_CLOCK 0x80
@@ -253,6 +271,25 @@ __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
 #endif
 }
 
+__attribute__((weak)) bool oled_send_data_async(const uint8_t *data, uint16_t size) {
+#if defined(OLED_ASYNC_TRANSFER)
+    if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
+        return false;
+    }
+    // Data Mode
+    gpio_write_pin_high(OLED_DC_PIN);
+    // Start sending the data, the bus is released by the next spi_start() once it has gone out
+    if (spi_transmit_async(data, size) != SPI_STATUS_SUCCESS) {
+        spi_stop();
+        return false;
+    }
+    spi_stop_async();
+    return true;
+#else
+    return oled_send_data(data, size);
+#endif
+}
+
 __attribute__((weak)) void oled_driver_init(void) {
 #if defined(OLED_TRANSPORT_SPI)
     spi_init();
@@ -382,7 +419,7 @@ void oled_clear(void) {
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
 
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
+static void calc_bounds(uint8_t update_start, uint16_t length, uint8_t *cmd_array) {
     // Calculate commands to set memory addressing bounds.
     uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
     uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
@@ -393,11 +430,13 @@ static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
     cmd_array[1] = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
     cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
 #else
-    // Commands for use in Horizontal Addressing mode.
-    cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
-    cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
+    // Commands for use in Horizontal Addressing mode. Writes spanning several pages start at column 0, see
+    // burst_length(), so those use the full width of the display.
+    uint8_t end_column = (start_column + length <= OLED_DISPLAY_WIDTH) ? start_column + length - 1 : OLED_DISPLAY_WIDTH - 1;
+    cmd_array[1]       = start_column + OLED_COLUMN_OFFSET;
+    cmd_array[4]       = start_page;
+    cmd_array[2]       = end_column + OLED_COLUMN_OFFSET;
+    cmd_array[5]       = (start_column + length - 1) / OLED_DISPLAY_WIDTH + cmd_array[4];
 #endif
 }
 
@@ -431,19 +470,55 @@ static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
 #endif
 }
 
-uint8_t crot(uint8_t a, int8_t n) {
-    const uint8_t mask = 0x7;
-    n &= mask;
-    return a << n | a >> (-n & mask);
+// Number of dirty blocks from update_start onwards that can be written to the display as one transfer
+static uint8_t burst_length(uint8_t update_start) {
+    // Page Addressing Mode doesn't move on to the next page, so writes end with the page they started in
+    uint16_t start = OLED_BLOCK_SIZE * update_start;
+    uint16_t limit = OLED_DISPLAY_WIDTH - start % OLED_DISPLAY_WIDTH;
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    // The addressing window wraps back to its start column, so only a write starting at column 0 can span pages
+    if (limit == OLED_DISPLAY_WIDTH) {
+        limit = OLED_MATRIX_SIZE - start;
+    }
+#endif
+
+    uint8_t count = 1;
+    while (count < OLED_UPDATE_BURST_LIMIT && update_start + count < OLED_BLOCK_COUNT && OLED_BLOCK_SIZE * (count + 1) <= limit && (oled_dirty & ((OLED_BLOCK_TYPE)1 << (update_start + count)))) {
+        ++count;
+    }
+    return count;
 }
 
+// Rotates an 8x8 tile, bit i of src[j] becoming bit 7 - j of dest[i]. This is an 8x8 bit matrix transpose, done by
+// swapping progressively smaller sub-blocks with shifts and masks (Hacker's Delight, 7-3) rather than bit by bit.
 static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
-        }
-    }
+    uint32_t x = ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 8) | src[3];
+    uint32_t y = ((uint32_t)src[4] << 24) | ((uint32_t)src[5] << 16) | ((uint32_t)src[6] << 8) | src[7];
+    uint32_t t;
+
+    // Swap bits within 2x2 blocks, then 2x2 blocks within 4x4 blocks
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    // Swap the 4x4 blocks
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+
+    // The transposed rows come out in reverse order
+    dest[7] = t >> 24;
+    dest[6] = t >> 16;
+    dest[5] = t >> 8;
+    dest[4] = t;
+    dest[3] = y >> 24;
+    dest[2] = y >> 16;
+    dest[1] = y >> 8;
+    dest[0] = y;
 }
 
 void oled_render_dirty(bool all) {
@@ -464,14 +539,20 @@ void oled_render_dirty(bool all) {
             ++update_start;
         }
 
+        // Unrotated blocks are laid out as in display memory, so contiguous ones are merged into a single transfer
+        uint8_t num_blocks = 1;
+        if (!OLED_RENDER_ROTATED) {
+            num_blocks = burst_length(update_start);
+        }
+
         // Set column & page position
 #if OLED_IC_HAS_HORIZONTAL_MODE
         static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
 #else
         static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
 #endif
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+        if (!OLED_RENDER_ROTATED) {
+            calc_bounds(update_start, OLED_BLOCK_SIZE * num_blocks, &display_start[1]); // Offset from I2C_CMD byte at the start
         } else {
             calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
         }
@@ -482,9 +563,12 @@ void oled_render_dirty(bool all) {
             return;
         }
 
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
+        if (!OLED_RENDER_ROTATED) {
+            // Send render data chunk as is. Unless everything has to be on the display on return, the transfer may
+            // still be running when drawing into the buffer resumes; anything changed then will be dirty again, and
+            // is resent in full by a later render.
+            const uint8_t *data = &oled_buffer[OLED_BLOCK_SIZE * update_start];
+            if (!(all ? oled_send_data(data, OLED_BLOCK_SIZE * num_blocks) : oled_send_data_async(data, OLED_BLOCK_SIZE * num_blocks))) {
                 print("oled_render data failed\n");
                 return;
             }
@@ -494,7 +578,6 @@ void oled_render_dirty(bool all) {
             const static uint8_t target_map[] = OLED_TARGET_MAP;
 
             static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
             for (uint8_t i = 0; i < sizeof(source_map); ++i) {
                 rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
             }
@@ -527,11 +610,61 @@ void oled_render_dirty(bool all) {
 #endif
         }
 
-        // Clear dirty flag of just rendered block
-        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        // Clear dirty flags of just rendered blocks
+        oled_dirty &= ~((OLED_BLOCK_TYPE)(OLED_ALL_BLOCKS_MASK >> (OLED_BLOCK_COUNT - num_blocks)) << update_start);
+        update_start += num_blocks;
     }
 }
 
+#ifdef OLED_NATIVE_ROTATION
+// With the buffer in display layout, the bits of a byte at the given index of the rotated layout are spread over the
+// same bit of 8 adjacent display columns. Returns the first of those columns, along with the bit.
+static uint8_t *native_columns(uint16_t index, uint8_t *shift) {
+    uint8_t y = OLED_DISPLAY_HEIGHT - 1 - index % OLED_DISPLAY_HEIGHT;
+    *shift    = y % 8;
+    return &oled_buffer[y / 8 * OLED_DISPLAY_WIDTH + index / OLED_DISPLAY_HEIGHT * 8];
+}
+#endif
+
+// Reads a byte of the buffer as it is laid out for drawing
+static uint8_t buffer_read(uint16_t index) {
+#ifdef OLED_NATIVE_ROTATION
+    if (HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        uint8_t        shift;
+        const uint8_t *columns = native_columns(index, &shift);
+        uint8_t        data    = 0;
+        for (uint8_t i = 0; i < 8; ++i) {
+            data |= ((columns[i] >> shift) & 1) << i;
+        }
+        return data;
+    }
+#endif
+    return oled_buffer[index];
+}
+
+// Writes a byte of the buffer as it is laid out for drawing, marking its block dirty if it changed
+static void buffer_write(uint16_t index, uint8_t data) {
+#ifdef OLED_NATIVE_ROTATION
+    if (HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        uint8_t  shift;
+        uint8_t *columns = native_columns(index, &shift);
+        uint8_t  changed = 0;
+        for (uint8_t i = 0; i < 8; ++i) {
+            uint8_t column = (columns[i] & ~(1 << shift)) | (((data >> i) & 1) << shift);
+            changed |= column ^ columns[i];
+            columns[i] = column;
+        }
+        if (changed) {
+            oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((columns - &oled_buffer[0]) / OLED_BLOCK_SIZE));
+        }
+        return;
+    }
+#endif
+    if (oled_buffer[index] == data) return;
+    oled_buffer[index] = data;
+    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+}
+
 void oled_set_cursor(uint8_t col, uint8_t line) {
     uint16_t index = line * oled_rotation_width + col * OLED_FONT_WIDTH;
 
@@ -597,32 +730,28 @@ void oled_write_char(const char data, bool invert) {
         return;
     }
 
-    // copy the current render buffer to check for dirty after
     static uint8_t oled_temp_buffer[OLED_FONT_WIDTH];
-    memcpy(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH);
 
     _Static_assert(sizeof(font) >= ((OLED_FONT_END + 1 - OLED_FONT_START) * OLED_FONT_WIDTH), "OLED_FONT_END references outside array");
 
-    // set the reder buffer data
+    // set the render data
     uint8_t cast_data = (uint8_t)data; // font based on unsigned type for index
     if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
-        memset(oled_cursor, 0x00, OLED_FONT_WIDTH);
+        memset(oled_temp_buffer, 0x00, OLED_FONT_WIDTH);
     } else {
         const uint8_t *glyph = &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH];
-        memcpy_P(oled_cursor, glyph, OLED_FONT_WIDTH);
+        memcpy_P(oled_temp_buffer, glyph, OLED_FONT_WIDTH);
     }
 
     // Invert if needed
     if (invert) {
-        InvertCharacter(oled_cursor);
+        InvertCharacter(oled_temp_buffer);
     }
 
-    // Dirty check
-    if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
-        uint16_t index = oled_cursor - &oled_buffer[0];
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
-        // Edgecase check if the written data spans the 2 chunks
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
+    // Copy to the buffer, marking any blocks that changed as dirty
+    uint16_t index = oled_cursor - &oled_buffer[0];
+    for (uint8_t i = 0; i < OLED_FONT_WIDTH; ++i) {
+        buffer_write(index + i, oled_temp_buffer[i]);
     }
 
     // Finally move to the next char
@@ -670,19 +799,14 @@ oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
 
 void oled_write_raw_byte(const char data, uint16_t index) {
     if (index > OLED_MATRIX_SIZE) index = OLED_MATRIX_SIZE;
-    if (oled_buffer[index] == data) return;
-    oled_buffer[index] = data;
-    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    buffer_write(index, data);
 }
 
 void oled_write_raw(const char *data, uint16_t size) {
     uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
     if ((size + cursor_start_index) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - cursor_start_index;
     for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
-        uint8_t c = *data++;
-        if (oled_buffer[i] == c) continue;
-        oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        buffer_write(i, *data++);
     }
 }
 
@@ -694,16 +818,13 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     if (index >= OLED_MATRIX_SIZE) {
         return;
     }
-    uint8_t data = oled_buffer[index];
+    uint8_t data = buffer_read(index);
     if (on) {
         data |= (1 << (y % 8));
     } else {
         data &= ~(1 << (y % 8));
     }
-    if (oled_buffer[index] != data) {
-        oled_buffer[index] = data;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
-    }
+    buffer_write(index, data);
 }
 
 #if defined(__AVR__)
@@ -724,10 +845,7 @@ void oled_write_raw_P(const char *data, uint16_t size) {
     uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
     if ((size + cursor_start_index) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - cursor_start_index;
     for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
-        uint8_t c = pgm_read_byte(data++);
-        if (oled_buffer[i] == c) continue;
-        oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        buffer_write(i, pgm_read_byte(data++));
     }
 }
 #endif // defined(__AVR__)
@@ -342,6 +342,9 @@ bool oled_init(oled_rotation_t rotation);
 bool oled_send_cmd(const uint8_t *data, uint16_t size);
 bool oled_send_cmd_P(const uint8_t *data, uint16_t size);
 bool oled_send_data(const uint8_t *data, uint16_t size);
+// Like oled_send_data, but may return while the data is still being sent. Sends synchronously unless the transport
+// supports background transfers (SPI on ChibiOS).
+bool oled_send_data_async(const uint8_t *data, uint16_t size);
 void oled_driver_init(void);
 
 // Called at the start of oled_init, weak function overridable by the user
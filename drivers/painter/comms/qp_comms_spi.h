@@ -12,6 +12,13 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
 
+// Background transfers rely on spi_transmit_async(), which is only provided on ChibiOS
+#    if QUANTUM_PAINTER_ASYNC_COMMS && defined(PROTOCOL_CHIBIOS)
+#        define QUANTUM_PAINTER_SPI_ASYNC_AVAILABLE TRUE
+#    else
+#        define QUANTUM_PAINTER_SPI_ASYNC_AVAILABLE FALSE
+#    endif
+
 typedef struct qp_comms_spi_config_t {
     pin_t    chip_select_pin;
     uint16_t divisor;
@@ -24,6 +31,10 @@ bool     qp_comms_spi_start(painter_device_t device);
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void* data, uint32_t byte_count);
 void     qp_comms_spi_stop(painter_device_t device);
 
+#    if QUANTUM_PAINTER_SPI_ASYNC_AVAILABLE
+uint32_t qp_comms_spi_send_data_async(painter_device_t device, const void* data, uint32_t byte_count);
+#    endif // QUANTUM_PAINTER_SPI_ASYNC_AVAILABLE
+
 extern const painter_comms_vtable_t spi_comms_vtable;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +52,9 @@ typedef struct qp_comms_spi_dc_reset_config_t {
 bool     qp_comms_spi_dc_reset_init(painter_device_t device);
 void     qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd);
 uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void* data, uint32_t byte_count);
+#        if QUANTUM_PAINTER_SPI_ASYNC_AVAILABLE
+uint32_t qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void* data, uint32_t byte_count);
+#        endif // QUANTUM_PAINTER_SPI_ASYNC_AVAILABLE
 void     qp_comms_spi_dc_reset_bulk_command_sequence(painter_device_t device, const uint8_t* sequence, size_t sequence_len);
 
 extern const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable;
@@ -21,6 +21,15 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of separate dirty regions tracked by each surface. Pixels changed close to an
+ *      existing region extend it, anything further away starts a new region until all are in use -- after which the
+ *      regions are merged such that the least unchanged area is redrawn. Each region requires 8 bytes of RAM.
+ */
+#    define SURFACE_DIRTY_RECTS 4
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
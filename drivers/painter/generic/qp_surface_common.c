@@ -29,24 +29,143 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
-void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
-    // Maintain dirty region
-    if (dirty->l > x) {
-        dirty->l        = x;
-        dirty->is_dirty = true;
+// Regions within this many pixels of each other are combined, as each separate region costs a viewport change
+#define SURFACE_DIRTY_MERGE_DISTANCE 8
+
+_Static_assert(SURFACE_DIRTY_RECTS > 0 && SURFACE_DIRTY_RECTS <= UINT8_MAX, "SURFACE_DIRTY_RECTS must be between 1 and 255");
+
+static inline uint32_t dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return ((uint32_t)(rect->r - rect->l + 1)) * (rect->b - rect->t + 1);
+}
+
+static inline void dirty_rect_union(surface_dirty_rect_t *target, const surface_dirty_rect_t *other) {
+    target->l = QP_MIN(target->l, other->l);
+    target->t = QP_MIN(target->t, other->t);
+    target->r = QP_MAX(target->r, other->r);
+    target->b = QP_MAX(target->b, other->b);
+}
+
+static inline bool dirty_rect_near(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return (uint32_t)a->l <= (uint32_t)b->r + SURFACE_DIRTY_MERGE_DISTANCE && (uint32_t)b->l <= (uint32_t)a->r + SURFACE_DIRTY_MERGE_DISTANCE && (uint32_t)a->t <= (uint32_t)b->b + SURFACE_DIRTY_MERGE_DISTANCE && (uint32_t)b->t <= (uint32_t)a->b + SURFACE_DIRTY_MERGE_DISTANCE;
+}
+
+// Additional area that would need to be transferred if the two regions were combined
+static inline uint32_t dirty_rect_union_cost(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    surface_dirty_rect_t combined = *a;
+    dirty_rect_union(&combined, b);
+    uint32_t separate = dirty_rect_area(a) + dirty_rect_area(b);
+    uint32_t area     = dirty_rect_area(&combined);
+    return area > separate ? area - separate : 0;
+}
+
+static inline void dirty_rect_remove(surface_dirty_data_t *dirty, uint8_t index) {
+    dirty->rects[index] = dirty->rects[--dirty->num_rects];
+}
+
+// Folds any regions close to the supplied one into it, as a grown region may now overlap its neighbours
+static void dirty_rect_absorb_neighbours(surface_dirty_data_t *dirty, uint8_t index) {
+    bool merged;
+    do {
+        merged = false;
+        for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+            if (i != index && dirty_rect_near(&dirty->rects[index], &dirty->rects[i])) {
+                dirty_rect_union(&dirty->rects[index], &dirty->rects[i]);
+                if (index == dirty->num_rects - 1) {
+                    index = i;
+                }
+                dirty_rect_remove(dirty, i);
+                merged = true;
+                break;
+            }
+        }
+    } while (merged);
+}
+
+void qp_surface_mark_dirty(surface_dirty_data_t *dirty, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    surface_dirty_rect_t area = {.l = l, .t = t, .r = r, .b = b};
+
+    // Maintain the bounding box
+    if (!dirty->is_dirty) {
+        dirty->l = l;
+        dirty->t = t;
+        dirty->r = r;
+        dirty->b = b;
+    } else {
+        dirty->l = QP_MIN(dirty->l, l);
+        dirty->t = QP_MIN(dirty->t, t);
+        dirty->r = QP_MAX(dirty->r, r);
+        dirty->b = QP_MAX(dirty->b, b);
+    }
+    dirty->is_dirty = true;
+
+    // Extend an existing region if it's close enough
+    for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+        if (dirty_rect_near(&dirty->rects[i], &area)) {
+            dirty_rect_union(&dirty->rects[i], &area);
+            dirty_rect_absorb_neighbours(dirty, i);
+            return;
+        }
+    }
+
+    // Otherwise start a new one, if there's room
+    if (dirty->num_rects < SURFACE_DIRTY_RECTS) {
+        dirty->rects[dirty->num_rects++] = area;
+        return;
     }
-    if (dirty->r < x) {
-        dirty->r        = x;
-        dirty->is_dirty = true;
+
+    // All regions are in use, so either extend the region or combine the pair of regions which redraw the least
+    // additional unchanged area as a result
+    uint8_t  best_rect = 0;
+    uint32_t best_cost = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+        uint32_t cost = dirty_rect_union_cost(&dirty->rects[i], &area);
+        if (cost < best_cost) {
+            best_rect = i;
+            best_cost = cost;
+        }
+    }
+
+    uint8_t  pair_a    = 0;
+    uint8_t  pair_b    = 0;
+    uint32_t pair_cost = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+        for (uint8_t j = i + 1; j < dirty->num_rects; ++j) {
+            uint32_t cost = dirty_rect_union_cost(&dirty->rects[i], &dirty->rects[j]);
+            if (cost < pair_cost) {
+                pair_a    = i;
+                pair_b    = j;
+                pair_cost = cost;
+            }
+        }
     }
-    if (dirty->t > y) {
-        dirty->t        = y;
-        dirty->is_dirty = true;
+
+    if (pair_cost < best_cost) {
+        dirty_rect_union(&dirty->rects[pair_a], &dirty->rects[pair_b]);
+        dirty->rects[pair_b] = area;
+        dirty_rect_absorb_neighbours(dirty, pair_a);
+    } else {
+        dirty_rect_union(&dirty->rects[best_rect], &area);
+        dirty_rect_absorb_neighbours(dirty, best_rect);
     }
-    if (dirty->b < y) {
-        dirty->b        = y;
-        dirty->is_dirty = true;
+}
+
+void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    // Pixels are mostly streamed into areas which are already dirty, so check those before anything else
+    for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+        surface_dirty_rect_t *rect = &dirty->rects[i];
+        if (rect->l <= x && x <= rect->r && rect->t <= y && y <= rect->b) {
+            return;
+        }
     }
+
+    qp_surface_mark_dirty(dirty, x, y, x, y);
+}
+
+void qp_surface_clear_dirty(surface_dirty_data_t *dirty) {
+    dirty->l = dirty->t = UINT16_MAX;
+    dirty->r = dirty->b = 0;
+    dirty->is_dirty     = false;
+    dirty->num_rects    = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +176,8 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    qp_surface_clear_dirty(&surface->dirty);
+    qp_surface_mark_dirty(&surface->dirty, 0, 0, surface->base.panel_width - 1, surface->base.panel_height - 1);
 
     return true;
 }
@@ -80,9 +196,7 @@ bool qp_surface_clear(painter_device_t device) {
 bool qp_surface_flush(painter_device_t device) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    surface->dirty.l = surface->dirty.t = UINT16_MAX;
-    surface->dirty.r = surface->dirty.b = 0;
-    surface->dirty.is_dirty             = false;
+    qp_surface_clear_dirty(&surface->dirty);
     return true;
 }
 
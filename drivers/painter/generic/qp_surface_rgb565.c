@@ -68,14 +68,9 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb565_target_pixdata_transfer_rect(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
-
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
@@ -86,9 +81,11 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     // Housekeeping of the amount of pixels to transfer
     uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_driver->native_bits_per_pixel;
     uint32_t  pixel_counter     = 0;
-    uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
+    uint16_t *target_buffer;
 
     // Fill the global pixdata area so that we can start transferring to the panel
+    qp_internal_pixdata_buffer_prepare();
+    target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
     for (uint16_t y = t; y <= b; ++y) {
         for (uint16_t x = l; x <= r; ++x) {
             // Update the target buffer
@@ -101,8 +98,10 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
                     qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
                     return false;
                 }
-                // Reset the counter
+                // Reset the counter, carrying on in the other buffer while this one is transmitted
                 pixel_counter = 0;
+                qp_internal_pixdata_buffer_prepare();
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
             }
         }
     }
@@ -119,6 +118,24 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     return true;
 }
 
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        return rgb565_target_pixdata_transfer_rect(surface_driver, target_driver, x, y, 0, 0, surface_handle->base.panel_width - 1, surface_handle->base.panel_height - 1);
+    }
+
+    // Only the separate dirty regions are sent, rather than everything in between
+    for (uint8_t i = 0; i < surface_handle->dirty.num_rects; ++i) {
+        surface_dirty_rect_t *rect = &surface_handle->dirty.rects[i];
+        if (!rgb565_target_pixdata_transfer_rect(surface_driver, target_driver, x, y, rect->l, rect->t, rect->r, rect->b)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
@@ -136,6 +153,7 @@ const surface_painter_driver_vtable_t rgb565_surface_driver_vtable = {
             .palette_convert = qp_surface_palette_convert_rgb565_swapped,
             .append_pixels   = qp_surface_append_pixels_rgb565,
             .append_pixdata  = qp_surface_append_pixdata_rgb565,
+            .fill_pixels     = qp_internal_fill_pixels_rgb565,
         },
     .target_pixdata_transfer = rgb565_target_pixdata_transfer,
 };
@@ -74,6 +74,7 @@ const tft_panel_dc_reset_painter_driver_vtable_t ssd1351_driver_vtable = {
             .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
             .append_pixels   = qp_tft_panel_append_pixels_rgb565,
             .append_pixdata  = qp_tft_panel_append_pixdata,
+            .fill_pixels     = qp_internal_fill_pixels_rgb565,
         },
     .num_window_bytes   = 1,
     .swap_window_coords = true,
@@ -127,6 +127,39 @@ bool qp_tft_panel_append_pixels_rgb888(painter_device_t device, uint8_t *target_
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Fill the start of the target buffer with a single pixel, using 32-bit stores -- the pixdata buffer is 4-byte aligned
+// RGB565 panels use qp_internal_fill_pixels_rgb565(), shared with the surfaces
+
+bool qp_tft_panel_fill_pixels_rgb888(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *color, uint32_t pixel_count) {
+    // Four pixels make up three whole words
+    uint8_t pattern_bytes[12];
+    for (uint8_t i = 0; i < 4; ++i) {
+        pattern_bytes[i * 3 + 0] = color->rgb888.r;
+        pattern_bytes[i * 3 + 1] = color->rgb888.g;
+        pattern_bytes[i * 3 + 2] = color->rgb888.b;
+    }
+    uint32_t pattern[3];
+    memcpy(pattern, pattern_bytes, sizeof(pattern));
+
+    uint32_t *words  = (uint32_t *)target_buffer;
+    uint32_t  groups = pixel_count / 4;
+    for (uint32_t i = 0; i < groups; ++i) {
+        words[i * 3 + 0] = pattern[0];
+        words[i * 3 + 1] = pattern[1];
+        words[i * 3 + 2] = pattern[2];
+    }
+    for (uint32_t i = groups * 4; i < pixel_count; ++i) {
+        target_buffer[i * 3 + 0] = color->rgb888.r;
+        target_buffer[i * 3 + 1] = color->rgb888.g;
+        target_buffer[i * 3 + 2] = color->rgb888.b;
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Append raw pixel data to the target location
+
 bool qp_tft_panel_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
@@ -41,6 +41,14 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+size_t backing_store_erase_sector_count(void) {
+    return ((WEAR_LEVELING_BACKING_SIZE) + (EXTERNAL_FLASH_SECTOR_SIZE)-1) / (EXTERNAL_FLASH_SECTOR_SIZE);
+}
+
+bool backing_store_erase_sector(size_t index) {
+    return flash_erase_sector((WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + index * (EXTERNAL_FLASH_SECTOR_SIZE)) == FLASH_STATUS_SUCCESS;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
@@ -0,0 +1,65 @@
+"""This script packs Quantum Painter assets into an image for external flash.
+"""
+import struct
+from qmk.path import normpath
+from milc import cli
+
+# Must match qp_flash_directory_header_v1_t and qp_flash_directory_entry_v1_t in quantum/painter/qp_stream.h, checked by
+# loading quantum/painter/tests/flash-assets.bin.c in the painter_flash test
+DIRECTORY_MAGIC = b'QPAD'
+DIRECTORY_VERSION = 1
+DIRECTORY_HEADER = struct.Struct('<4sHH')
+DIRECTORY_ENTRY = struct.Struct('<II24s')
+MAX_NAME_LENGTH = 23
+
+
+@cli.argument('-o', '--output', required=True, help='Specify output flash image file.')
+@cli.argument('-a', '--alignment', default=256, type=int, help='Align each asset to this many bytes. Default 256, the usual flash page size.')
+@cli.argument('inputs', nargs='+', arg_only=True, help='QGF/QFF files to pack, as written by the --raw option of the conversion commands. Each asset is named after its file, without the extension.')
+@cli.subcommand('Packs QGF/QFF files into a flash image with an asset directory')
+def painter_pack_assets(cli):
+    """Packs raw QGF images and QFF fonts into a single image to be written to external flash.
+
+    The image starts with a directory of all the assets, which is used by `qp_load_image_flash()` and `qp_load_font_flash()` to find them by name.
+    """
+    if cli.args.alignment < 1:
+        cli.log.error('Alignment must be at least 1.')
+        return False
+
+    # Read all the assets, checking their names are usable
+    assets = {}
+    for input_file in cli.args.inputs:
+        input_file = normpath(input_file)
+        if not input_file.exists():
+            cli.log.error('Input file %s does not exist!', input_file)
+            return False
+
+        name = input_file.stem
+        if len(name.encode('utf-8')) > MAX_NAME_LENGTH:
+            cli.log.error('Asset name "%s" is longer than %d bytes.', name, MAX_NAME_LENGTH)
+            return False
+        if name in assets:
+            cli.log.error('Asset name "%s" is used more than once.', name)
+            return False
+
+        assets[name] = input_file.read_bytes()
+
+    def align(offset):
+        return (offset + cli.args.alignment - 1) // cli.args.alignment * cli.args.alignment
+
+    # Lay out the assets after the directory, with offsets relative to its start. Padding is left as erased flash.
+    output = bytearray(DIRECTORY_HEADER.pack(DIRECTORY_MAGIC, DIRECTORY_VERSION, len(assets)))
+    offset = align(DIRECTORY_HEADER.size + DIRECTORY_ENTRY.size * len(assets))
+    layout = []
+    for name, contents in assets.items():
+        output += DIRECTORY_ENTRY.pack(offset, len(contents), name.encode('utf-8'))
+        layout.append((offset, contents))
+        offset = align(offset + len(contents))
+
+    for offset, contents in layout:
+        output += b'\xFF' * (offset - len(output))
+        output += contents
+
+    output_file = normpath(cli.args.output)
+    output_file.write_bytes(output)
+    cli.log.info('Wrote %d assets (%d bytes) to %s.', len(assets), len(output), output_file)
@@ -10,6 +10,282 @@
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+#    include <string.h>
+#    include "serial_usart.h"
+#    include "timer.h"
+#    include "util.h"
+#    include "wait.h"
+
+/* Baudrates that are probed at startup, fastest first. The configured
+ * SERIAL_USART_SPEED is always appended as the last resort. */
+#    if !defined(SERIAL_USART_SPEED_CANDIDATES)
+#        define SERIAL_USART_SPEED_CANDIDATES 1843200, 921600, 460800
+#    endif
+
+/* Amount of test pattern round trips that have to succeed for a speed to be accepted. */
+#    if !defined(SERIAL_USART_SPEED_PROBE_COUNT)
+#        define SERIAL_USART_SPEED_PROBE_COUNT 16
+#    endif
+
+/* Test pattern round trips per negotiation step. Negotiation runs at most one
+ * step per millisecond, so it is spread over scans instead of holding one up. */
+#    if !defined(SERIAL_USART_SPEED_PROBES_PER_STEP)
+#        define SERIAL_USART_SPEED_PROBES_PER_STEP 4
+#    endif
+
+/* Negotiation gives up after this many milliseconds, keeping the last speed that passed. */
+#    if !defined(SERIAL_USART_SPEED_NEGOTIATION_TIMEOUT)
+#        define SERIAL_USART_SPEED_NEGOTIATION_TIMEOUT 1000
+#    endif
+
+#    if !defined(SERIAL_USART_SPEED_PROBE_SIZE)
+#        define SERIAL_USART_SPEED_PROBE_SIZE 32
+#    endif
+
+/* Step down one speed if more than SERIAL_USART_SPEED_MAX_ERRORS out of
+ * SERIAL_USART_SPEED_ERROR_WINDOW transactions failed. */
+#    if !defined(SERIAL_USART_SPEED_ERROR_WINDOW)
+#        define SERIAL_USART_SPEED_ERROR_WINDOW 256
+#    endif
+
+#    if !defined(SERIAL_USART_SPEED_MAX_ERRORS)
+#        define SERIAL_USART_SPEED_MAX_ERRORS 4
+#    endif
+
+/* Both halves fall back to SERIAL_USART_SPEED if no transaction succeeded for this many milliseconds. */
+#    if !defined(SERIAL_USART_SPEED_RECOVERY_TIMEOUT)
+#        define SERIAL_USART_SPEED_RECOVERY_TIMEOUT 250
+#    endif
+
+/* Time the master grants the slave to reconfigure its peripheral after a speed change. */
+#    if !defined(SERIAL_USART_SPEED_SWITCH_DELAY_US)
+#        define SERIAL_USART_SPEED_SWITCH_DELAY_US 100
+#    endif
+
+static const uint32_t serial_speeds[] = {SERIAL_USART_SPEED_CANDIDATES, SERIAL_USART_SPEED};
+
+#    define SERIAL_SPEED_BASE_INDEX ((uint8_t)(ARRAY_SIZE(serial_speeds) - 1))
+
+/* Speed control tokens are sent in place of a transaction id, which only uses 5 bits. */
+#    define SERIAL_SPEED_CONTROL_FLAG 0x80
+#    define SERIAL_SPEED_PROBE_TOKEN 0xC0
+#    define SERIAL_SPEED_REQUEST_TOKEN(index) (SERIAL_SPEED_CONTROL_FLAG | (index))
+
+_Static_assert(NUM_TOTAL_TRANSACTIONS < SERIAL_SPEED_CONTROL_FLAG, "Transaction ids collide with speed control tokens");
+_Static_assert(ARRAY_SIZE(serial_speeds) < (SERIAL_SPEED_PROBE_TOKEN & ~SERIAL_SPEED_CONTROL_FLAG), "Too many SERIAL_USART_SPEED_CANDIDATES");
+
+static uint8_t  speed_index = SERIAL_SPEED_BASE_INDEX;
+static uint16_t last_successful_transaction;
+
+static void set_link_speed(uint8_t index) {
+    speed_index = index;
+    serial_transport_driver_set_speed(serial_speeds[index]);
+    serial_dprintf("SPLIT: link speed %lu baud\n", serial_speeds[index]);
+}
+
+/**
+ * @brief Fall back to SERIAL_USART_SPEED if the link has been dead for too
+ * long. Both halves do this on their own, so they will meet again at the base
+ * speed even if a speed change was only picked up by one of them.
+ */
+static bool recover_link_speed(bool success) {
+    if (success) {
+        last_successful_transaction = timer_read();
+        return false;
+    }
+
+    if (speed_index != SERIAL_SPEED_BASE_INDEX && timer_elapsed(last_successful_transaction) > SERIAL_USART_SPEED_RECOVERY_TIMEOUT) {
+        set_link_speed(SERIAL_SPEED_BASE_INDEX);
+        last_successful_transaction = timer_read();
+        return true;
+    }
+
+    return false;
+}
+
+static inline void fill_probe_pattern(uint8_t* pattern, uint8_t seed) {
+    /* Interleave worst case bit patterns with a running counter. */
+    static const uint8_t edges[] = {0x00, 0xFF, 0x55, 0xAA};
+    for (uint8_t i = 0; i < SERIAL_USART_SPEED_PROBE_SIZE; i++) {
+        pattern[i] = (i & 1) ? edges[(i >> 1) & 3] : (uint8_t)(seed + i);
+    }
+}
+
+/**
+ * @brief React to a speed control token sent by the master.
+ */
+static inline bool react_to_speed_control(uint8_t token) {
+    uint8_t ack = ~token;
+
+    if (token == SERIAL_SPEED_PROBE_TOKEN) {
+        uint8_t pattern[SERIAL_USART_SPEED_PROBE_SIZE];
+        /* Echo the test pattern back to the master, which does the comparison. */
+        return serial_transport_send(&ack, sizeof(ack)) && serial_transport_receive(pattern, sizeof(pattern)) && serial_transport_send(pattern, sizeof(pattern));
+    }
+
+    uint8_t index = token & ~SERIAL_SPEED_CONTROL_FLAG;
+    if (unlikely(index >= ARRAY_SIZE(serial_speeds))) {
+        return false;
+    }
+
+    /* Acknowledge at the old speed, then switch over. */
+    if (unlikely(!serial_transport_send(&ack, sizeof(ack)))) {
+        return false;
+    }
+    set_link_speed(index);
+    return true;
+}
+
+static uint8_t  speed_ceiling    = 0;
+static bool     speed_negotiated = false;
+static bool     negotiating      = false;
+static uint8_t  probes_passed;
+static uint16_t negotiation_start;
+static uint16_t last_negotiation_step;
+static uint16_t window_transactions;
+static uint16_t window_errors;
+
+/**
+ * @brief Send a speed control token to the slave and wait for its acknowledge.
+ */
+static bool send_speed_control(uint8_t token) {
+    serial_transport_driver_clear();
+
+    if (unlikely(!serial_transport_send(&token, sizeof(token)))) {
+        return false;
+    }
+
+    uint8_t ack      = 0;
+    uint8_t expected = ~token;
+    return serial_transport_receive(&ack, sizeof(ack)) && ack == expected;
+}
+
+/**
+ * @brief Switch both halves to the speed with the given index.
+ */
+static bool request_link_speed(uint8_t index) {
+    if (!send_speed_control(SERIAL_SPEED_REQUEST_TOKEN(index))) {
+        return false;
+    }
+    set_link_speed(index);
+    wait_us(SERIAL_USART_SPEED_SWITCH_DELAY_US);
+    return true;
+}
+
+/**
+ * @brief Send test patterns at the current speed and check the slave's echo.
+ */
+static bool probe_link_speed(uint8_t first, uint8_t count) {
+    uint8_t pattern[SERIAL_USART_SPEED_PROBE_SIZE];
+    uint8_t echo[SERIAL_USART_SPEED_PROBE_SIZE];
+
+    for (uint8_t probe = first; probe < first + count; probe++) {
+        fill_probe_pattern(pattern, probe);
+        if (!send_speed_control(SERIAL_SPEED_PROBE_TOKEN) || !serial_transport_send(pattern, sizeof(pattern)) || !serial_transport_receive(echo, sizeof(echo)) || memcmp(pattern, echo, sizeof(pattern)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void finish_negotiation(bool negotiated) {
+    speed_negotiated = negotiated;
+    negotiating      = false;
+}
+
+/**
+ * @brief Run one step of trying the candidate speeds fastest first: switch to
+ * the fastest untested one, send a few probes, then return to the current
+ * speed until it has passed all of them. Each scan is only held up for a
+ * bounded number of round trips, and real transactions keep running at a
+ * speed that passed.
+ */
+static void negotiate_link_speed(void) {
+    if (!negotiating) {
+        negotiating       = true;
+        probes_passed     = 0;
+        negotiation_start = timer_read();
+    } else if (timer_read() == last_negotiation_step) {
+        /* A scan usually runs several transactions, leave them be. */
+        return;
+    }
+    last_negotiation_step = timer_read();
+
+    if (speed_ceiling >= speed_index || timer_elapsed(negotiation_start) > SERIAL_USART_SPEED_NEGOTIATION_TIMEOUT) {
+        finish_negotiation(true);
+        return;
+    }
+
+    uint8_t fallback  = speed_index;
+    uint8_t candidate = speed_ceiling;
+
+    if (!request_link_speed(candidate)) {
+        serial_dprintf("SPLIT: speed negotiation not acknowledged\n");
+        finish_negotiation(true);
+        return;
+    }
+
+    uint8_t count = MIN(SERIAL_USART_SPEED_PROBES_PER_STEP, SERIAL_USART_SPEED_PROBE_COUNT - probes_passed);
+    if (probe_link_speed(probes_passed, count)) {
+        probes_passed += count;
+        if (probes_passed >= SERIAL_USART_SPEED_PROBE_COUNT) {
+            finish_negotiation(true);
+            return;
+        }
+    } else {
+        /* Never try this speed again. */
+        speed_ceiling = candidate + 1;
+        probes_passed = 0;
+    }
+
+    /* Return to the last good speed. If that fails as well, the recovery
+     * timeout brings both halves back. */
+    if (!request_link_speed(fallback)) {
+        set_link_speed(SERIAL_SPEED_BASE_INDEX);
+        finish_negotiation(false);
+    }
+}
+
+/**
+ * @brief Track the error rate of the link on the master and step down the
+ * speed if it rises.
+ */
+static void master_track_link_speed(bool success) {
+    uint8_t previous_index = speed_index;
+
+    if (recover_link_speed(success)) {
+        /* Renegotiate once the link is up again, but stay below the speed that died. */
+        speed_ceiling = MIN(previous_index + 1, SERIAL_SPEED_BASE_INDEX);
+        finish_negotiation(false);
+        window_transactions = window_errors = 0;
+        return;
+    }
+
+    if (success && !speed_negotiated) {
+        negotiate_link_speed();
+        window_transactions = window_errors = 0;
+        return;
+    }
+
+    window_transactions++;
+    if (!success) {
+        window_errors++;
+    }
+
+    if (window_transactions >= SERIAL_USART_SPEED_ERROR_WINDOW) {
+        if (window_errors > SERIAL_USART_SPEED_MAX_ERRORS && speed_index < SERIAL_SPEED_BASE_INDEX) {
+            speed_ceiling = speed_index + 1;
+            if (!request_link_speed(speed_ceiling)) {
+                set_link_speed(SERIAL_SPEED_BASE_INDEX);
+            }
+        }
+        window_transactions = window_errors = 0;
+    }
+}
+
+#endif // defined(SERIAL_USART_SPEED_NEGOTIATION)
+
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
  * by the master.
@@ -20,7 +296,11 @@ static THD_FUNCTION(SlaveThread, arg) {
     chRegSetThreadName("split_protocol_tx_rx");
 
     while (true) {
-        if (unlikely(!react_to_transaction())) {
+        bool success = react_to_transaction();
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+        recover_link_speed(success);
+#endif
+        if (unlikely(!success)) {
             /* Clear the receive queue, to start with a clean slate.
              * Parts of failed transactions or spurious bytes could still be in it. */
             serial_transport_driver_clear();
@@ -45,16 +325,35 @@ void soft_serial_initiator_init(void) {
     serial_transport_driver_master_init();
 }
 
+/**
+ * @brief Wait for the next transaction id from the master.
+ */
+static inline bool receive_transaction_id(uint8_t* transaction_id) {
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+    /* Above the base speed we have to wake up regularly to check for a dead link. */
+    if (speed_index != SERIAL_SPEED_BASE_INDEX) {
+        return serial_transport_receive(transaction_id, sizeof(*transaction_id));
+    }
+#endif
+    return serial_transport_receive_blocking(transaction_id, sizeof(*transaction_id));
+}
+
 /**
  * @brief React to transactions started by the master.
  */
 static inline bool react_to_transaction(void) {
     uint8_t transaction_id = 0;
     /* Wait until there is a transaction for us. */
-    if (unlikely(!serial_transport_receive_blocking(&transaction_id, sizeof(transaction_id)))) {
+    if (unlikely(!receive_transaction_id(&transaction_id))) {
         return false;
     }
 
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+    if (transaction_id & SERIAL_SPEED_CONTROL_FLAG) {
+        return react_to_speed_control(transaction_id);
+    }
+#endif
+
     /* Sanity check that we are actually responding to a valid transaction. */
     if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
         return false;
@@ -104,7 +403,13 @@ bool soft_serial_transaction(int index) {
      * Parts of failed transactions or spurious bytes could still be in it. */
     serial_transport_driver_clear();
 
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+    bool success = initiate_transaction((uint8_t)index);
+    master_track_link_speed(success);
+    return success;
+#else
     return initiate_transaction((uint8_t)index);
+#endif
 }
 
 /**
@@ -24,6 +24,14 @@ void serial_transport_driver_slave_init(void);
  */
 void serial_transport_driver_master_init(void);
 
+/**
+ * @brief Reconfigure the link to the given baudrate. Any data that is still
+ * pending for transmission is sent at the previous baudrate first.
+ *
+ * @param speed New baudrate in bits per second.
+ */
+void serial_transport_driver_set_speed(uint32_t speed);
+
 /**
  * @brief  Blocking receive of size * bytes.
  *
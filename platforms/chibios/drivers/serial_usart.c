@@ -6,6 +6,7 @@
 #include "serial_protocol.h"
 #include "synchronization_util.h"
 #include "chibios_config.h"
+#include "wait.h"
 
 #if defined(SERIAL_USART_CONFIG)
 static QMKSerialConfig serial_config = SERIAL_USART_CONFIG;
@@ -50,6 +51,30 @@ static inline void usart_driver_start(void) {
     sdStart(serial_driver, &serial_config);
 }
 
+/**
+ * @brief SERIAL Driver reconfiguration routine.
+ */
+static inline void usart_driver_restart(uint32_t speed) {
+    osalSysLock();
+    bool volatile queue_not_empty = !oqIsEmptyI(&serial_driver->oqueue);
+    osalSysUnlock();
+
+    /* The output queue is drained from an IRQ context, wait until it ran empty. */
+    while (queue_not_empty) {
+        wait_us(10);
+        osalSysLock();
+        queue_not_empty = !oqIsEmptyI(&serial_driver->oqueue);
+        osalSysUnlock();
+    }
+
+    /* Then give the last character ~12 bit times to leave the shift register. */
+    wait_us(1000000U * 12U / serial_config.speed);
+
+    sdStop(serial_driver);
+    serial_config.speed = speed;
+    sdStart(serial_driver, &serial_config);
+}
+
 inline void serial_transport_driver_clear(void) {
     osalSysLock();
     bool volatile queue_not_empty = !iqIsEmptyI(&serial_driver->iqueue);
@@ -80,6 +105,17 @@ static inline void usart_driver_start(void) {
     sioStart(serial_driver, &serial_config);
 }
 
+/**
+ * @brief SIO Driver reconfiguration routine.
+ */
+static inline void usart_driver_restart(uint32_t speed) {
+    (void)sioSynchronizeTXEnd(serial_driver, TIME_MS2I(SERIAL_USART_TIMEOUT));
+
+    sioStop(serial_driver);
+    serial_config.baud = speed;
+    sioStart(serial_driver, &serial_config);
+}
+
 inline void serial_transport_driver_clear(void) {
     if (sioHasRXErrorsX(serial_driver)) {
         sioGetAndClearErrors(serial_driver);
@@ -97,6 +133,10 @@ inline void serial_transport_driver_clear(void) {
 
 #endif
 
+void serial_transport_driver_set_speed(uint32_t speed) {
+    usart_driver_restart(speed);
+}
+
 inline bool serial_transport_send(const uint8_t* source, const size_t size) {
     bool success = (size_t)chnWriteTimeout(serial_driver, source, size, TIME_MS2I(SERIAL_USART_TIMEOUT)) == size;
 
@@ -19,6 +19,8 @@
 #include "timer.h"
 
 static bool spiStarted = false;
+// Set by spi_stop_async() while the bus is still claimed for a background transfer
+static bool spiStopPending = false;
 
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
 static pin_t currentSlavePin;
@@ -64,6 +66,9 @@ __attribute__((weak)) void spi_init(void) {
 }
 
 bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    if (spiStopPending) {
+        spi_stop();
+    }
     if (spiStarted) {
         return false;
     }
@@ -292,6 +297,7 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 }
 
 spi_status_t spi_write(uint8_t data) {
+    spi_wait();
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -299,6 +305,7 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+    spi_wait();
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -306,17 +313,33 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_wait();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_wait();
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_wait(void) {
+    // Completion of a background transfer is flagged from the SPI/DMA interrupt
+    volatile spistate_t *state = &SPI_DRIVER.state;
+    while (*state == SPI_ACTIVE || *state == SPI_COMPLETE) {
+    }
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_wait();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (spiStarted) {
+        spi_wait();
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
         if (currentSlavePin != NO_PIN) {
             gpio_write_pin_high(currentSlavePin);
@@ -324,6 +347,11 @@ void spi_stop(void) {
 #endif
         spiUnselect(&SPI_DRIVER);
         spiStop(&SPI_DRIVER);
-        spiStarted = false;
+        spiStarted     = false;
+        spiStopPending = false;
     }
 }
+
+void spi_stop_async(void) {
+    spiStopPending = spiStarted;
+}
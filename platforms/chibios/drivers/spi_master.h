@@ -85,9 +85,26 @@ spi_status_t spi_read(void);
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * @brief Starts transmitting the buffer in the background, returning before it has been sent. The buffer must not be
+ * modified until the transfer has completed -- any further SPI operation, including spi_stop(), waits for it first.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Waits for any transfer started by spi_transmit_async() to complete.
+ */
+void spi_wait(void);
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
 void spi_stop(void);
+
+/**
+ * @brief Ends the current transaction without waiting for a transfer started by spi_transmit_async() to complete. The
+ * bus stays claimed until the next spi_start(), which finishes the transfer and releases it first.
+ */
+void spi_stop_async(void);
 #ifdef __cplusplus
 }
 #endif
@@ -100,18 +100,9 @@ bool backing_store_erase(void) {
     uint32_t start = timer_read32();
 #endif
 
-    bool          ret = true;
-    flash_error_t status;
+    bool ret = true;
     for (int i = 0; i < sector_count; ++i) {
-        // Kick off the sector erase
-        status = flashStartEraseSector(flash, first_sector + i);
-        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
-            ret = false;
-        }
-
-        // Wait for the erase to complete
-        status = flashWaitErase(flash);
-        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+        if (!backing_store_erase_sector(i)) {
             ret = false;
         }
     }
@@ -120,6 +111,29 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+size_t backing_store_erase_sector_count(void) {
+    return sector_count;
+}
+
+bool backing_store_erase_sector(size_t index) {
+    bool          ret = true;
+    flash_error_t status;
+
+    // Kick off the sector erase
+    status = flashStartEraseSector(flash, first_sector + index);
+    if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+        ret = false;
+    }
+
+    // Wait for the erase to complete
+    status = flashWaitErase(flash);
+    if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+        ret = false;
+    }
+
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = (base_offset + address);
     bs_dprintf("Write ");
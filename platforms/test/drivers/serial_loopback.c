@@ -0,0 +1,214 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "crc.h"
+#include "serial.h"
+#include "serial_loopback.h"
+#include "transactions.h"
+#include "transport.h"
+
+/* Both halves live in the same process and therefore share `split_shmem`.
+ * The slave half gets its own copy of the shared memory, which is swapped in
+ * whenever slave callbacks run, and transactions copy their buffers between
+ * both copies - just like the real transport does between both MCUs.
+ *
+ * Per transaction slave callbacks - RPC handlers, the stream receiver and
+ * the pointing motion callback - do run, against the slave copy of the shared memory, exactly as they would
+ * from the serial interrupt on a real slave. All other globals are shared
+ * though, so the simulated slave never runs `transport_slave()` and its state
+ * sync handlers, which would apply the received state to the master. Instead
+ * it only publishes its matrix, polls its pointing device, runs the stream
+ * task, and tests inspect the state it received through
+ * `serial_loopback_get_slave_memory()`. */
+
+void advance_time(uint32_t ms);
+
+#define SERIAL_LOOPBACK_BITS_PER_BYTE 11
+
+static const serial_loopback_config_t default_config = {
+    .connected      = true,
+    .baudrate       = 230400,
+    .latency_us     = 0,
+    .bit_error_rate = 0,
+    .parity         = false,
+};
+
+static serial_loopback_config_t config = default_config;
+static serial_loopback_stats_t  stats;
+
+static split_shared_memory_t slave_memory;
+static split_shared_memory_t master_memory;
+
+static uint32_t pending_time_us;
+static uint32_t random_state = 1;
+
+static int8_t  drop_transaction_id = -1;
+static uint8_t drop_count          = 0;
+
+static void swap_in_slave_memory(void) {
+    memcpy(&master_memory, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &slave_memory, sizeof(split_shared_memory_t));
+}
+
+static void swap_out_slave_memory(void) {
+    memcpy(&slave_memory, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &master_memory, sizeof(split_shared_memory_t));
+}
+
+/**
+ * @brief Deterministic xorshift32 generator, so that failing tests can be replayed.
+ */
+static uint32_t next_random(void) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+/**
+ * @brief Move the test clock forward by the time the transfer took on the wire.
+ */
+static void consume_link_time(uint32_t bytes) {
+    uint32_t time_us = config.latency_us;
+    if (config.baudrate) {
+        time_us += (uint32_t)(((uint64_t)bytes * SERIAL_LOOPBACK_BITS_PER_BYTE * 1000000UL) / config.baudrate);
+    }
+
+    stats.link_time_us += time_us;
+    pending_time_us += time_us;
+    if (pending_time_us >= 1000) {
+        advance_time(pending_time_us / 1000);
+        pending_time_us %= 1000;
+    }
+}
+
+/**
+ * @brief Copy a buffer across the link, flipping bits according to the
+ * configured bit error rate.
+ *
+ * @return false if a corrupted byte was caught by the parity check.
+ */
+static bool transfer(uint8_t *destination, const uint8_t *source, uint16_t length) {
+    bool okay = true;
+
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t byte = source[i];
+        if (config.bit_error_rate) {
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                if (next_random() % 1000000UL < config.bit_error_rate) {
+                    byte ^= 1 << bit;
+                    stats.corrupted_bits++;
+                }
+            }
+        }
+        if (byte != source[i] && config.parity) {
+            okay = false;
+        }
+        destination[i] = byte;
+    }
+
+    return okay;
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int index) {
+    split_transaction_desc_t *trans = &split_transaction_table[index];
+
+    stats.transactions++;
+
+    /* Handshake: the transaction id and its XORed answer. */
+    uint8_t handshake = (uint8_t)index;
+    uint8_t received  = 0;
+    consume_link_time(2);
+    if (!config.connected || !transfer(&received, &handshake, sizeof(handshake)) || received != handshake) {
+        stats.failed_transactions++;
+        return false;
+    }
+
+    bool okay = true;
+
+    if (trans->initiator2target_buffer_size) {
+        consume_link_time(trans->initiator2target_buffer_size);
+        stats.bytes_to_slave += trans->initiator2target_buffer_size;
+        okay &= transfer((uint8_t *)&slave_memory + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    }
+
+    if (okay && trans->slave_callback) {
+        swap_in_slave_memory();
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        swap_out_slave_memory();
+    }
+
+    // The slave handled the request, but its response never makes it back
+    if (okay && index == drop_transaction_id && drop_count) {
+        drop_count--;
+        okay = false;
+    }
+
+    if (okay && trans->target2initiator_buffer_size) {
+        consume_link_time(trans->target2initiator_buffer_size);
+        stats.bytes_to_master += trans->target2initiator_buffer_size;
+        okay &= transfer(split_trans_target2initiator_buffer(trans), (uint8_t *)&slave_memory + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    }
+
+    if (!okay) {
+        stats.failed_transactions++;
+    }
+    return okay;
+}
+
+void serial_loopback_slave_task(const matrix_row_t slave_matrix[]) {
+    memcpy(slave_memory.smatrix.matrix, slave_matrix, sizeof(slave_memory.smatrix.matrix));
+    slave_memory.smatrix.checksum = crc8(slave_memory.smatrix.matrix, sizeof(slave_memory.smatrix.matrix));
+
+#if defined(SPLIT_STREAM_ENABLE)
+    // Streamed data is handed to the receiver hooks only, so it's safe to do so
+    split_stream_slave_task();
+#endif // defined(SPLIT_STREAM_ENABLE)
+
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    // The pointing device of the simulated slave is only read by this half
+    swap_in_slave_memory();
+    split_pointing_slave_task();
+    swap_out_slave_memory();
+#endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+}
+
+const split_shared_memory_t *serial_loopback_get_slave_memory(void) {
+    return &slave_memory;
+}
+
+void serial_loopback_reset(void) {
+    config          = default_config;
+    pending_time_us = 0;
+    random_state    = 1;
+    serial_loopback_drop_responses(-1, 0);
+    memset(&slave_memory, 0, sizeof(slave_memory));
+    serial_loopback_clear_stats();
+}
+
+void serial_loopback_set_config(const serial_loopback_config_t *new_config) {
+    config = *new_config;
+}
+
+void serial_loopback_drop_responses(int8_t transaction_id, uint8_t count) {
+    drop_transaction_id = transaction_id;
+    drop_count          = count;
+}
+
+serial_loopback_config_t serial_loopback_get_config(void) {
+    return config;
+}
+
+const serial_loopback_stats_t *serial_loopback_get_stats(void) {
+    return &stats;
+}
+
+void serial_loopback_clear_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,72 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+#include "transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Properties of the simulated link between both halves.
+ */
+typedef struct serial_loopback_config_t {
+    bool     connected;      // Whether the slave half answers at all
+    uint32_t baudrate;       // Bits per second on the wire, 11 bits are transferred per byte
+    uint32_t latency_us;     // Fixed turnaround time added to every transaction
+    uint32_t bit_error_rate; // Flipped bits per million transferred bits
+    bool     parity;         // Fail transactions with corrupted bytes instead of passing them on
+} serial_loopback_config_t;
+
+/**
+ * @brief Counters of everything that went over the simulated link.
+ */
+typedef struct serial_loopback_stats_t {
+    uint32_t transactions;
+    uint32_t failed_transactions;
+    uint32_t bytes_to_slave;
+    uint32_t bytes_to_master;
+    uint32_t corrupted_bits;
+    uint64_t link_time_us;
+} serial_loopback_stats_t;
+
+/**
+ * @brief Restore the default link configuration, clear the statistics and the
+ * memory of the simulated slave half.
+ */
+void serial_loopback_reset(void);
+
+void                     serial_loopback_set_config(const serial_loopback_config_t *config);
+serial_loopback_config_t serial_loopback_get_config(void);
+
+/**
+ * @brief Lose the responses of the next `count` executions of `transaction_id`
+ * after the slave has already handled them, as if they got corrupted on their
+ * way back to the master.
+ */
+void serial_loopback_drop_responses(int8_t transaction_id, uint8_t count);
+
+const serial_loopback_stats_t *serial_loopback_get_stats(void);
+void                           serial_loopback_clear_stats(void);
+
+/**
+ * @brief Publish the matrix of the simulated slave half for the next scan of
+ * the master, poll its pointing device, and deliver any data streamed to it.
+ */
+void serial_loopback_slave_task(const matrix_row_t slave_matrix[]);
+
+/**
+ * @brief Shared memory of the simulated slave half, i.e. everything it
+ * received from the master so far.
+ */
+const split_shared_memory_t *serial_loopback_get_slave_memory(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,244 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "eeprom_driver.h"
+#include "timer.h"
+void advance_time(uint32_t ms);
+}
+
+#define MOCK_EEPROM_SIZE 1024
+#define MOCK_WRITE_TIME_MS 5
+
+/* Page programmed external EEPROM, as seen through the eeprom_driver_XXXX
+ * functions. Accesses wait for the write cycle of the previous page, just like
+ * the i2c and spi drivers do, which moves the test clock forward. */
+static std::array<uint8_t, MOCK_EEPROM_SIZE> device;
+static uint32_t                              page_programs;
+static uint32_t                              device_reads;
+static uint32_t                              busy_until;
+static uint32_t                              stalled_ms;
+
+static void wait_while_busy(void) {
+    uint32_t now = timer_read32();
+    if (now < busy_until) {
+        stalled_ms += busy_until - now;
+        advance_time(busy_until - now);
+    }
+}
+
+extern "C" bool eeprom_driver_busy(void) {
+    return timer_read32() < busy_until;
+}
+
+extern "C" void eeprom_driver_read_block(void *buf, const void *addr, size_t len) {
+    uintptr_t offset = (uintptr_t)addr;
+    ASSERT_LE(offset + len, MOCK_EEPROM_SIZE);
+    wait_while_busy();
+    memcpy(buf, &device[offset], len);
+    device_reads++;
+}
+
+extern "C" void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
+    uintptr_t offset = (uintptr_t)addr;
+    ASSERT_LE(offset + len, MOCK_EEPROM_SIZE);
+    memcpy(&device[offset], buf, len);
+    // Same page splitting as the i2c and spi drivers, each page takes the full write cycle time
+    while (len > 0) {
+        size_t length = std::min<size_t>(EEPROM_WRITE_BACK_PAGE_SIZE - offset % EEPROM_WRITE_BACK_PAGE_SIZE, len);
+        wait_while_busy();
+        busy_until = timer_read32() + MOCK_WRITE_TIME_MS;
+        page_programs++;
+        offset += length;
+        len -= length;
+    }
+}
+
+class EepromWriteBack : public testing::Test {
+   protected:
+    void SetUp() override {
+        eeprom_write_back_flush();
+        for (size_t i = 0; i < device.size(); ++i) {
+            device[i] = (uint8_t)(i * 13);
+        }
+        timer_clear();
+        page_programs = 0;
+        device_reads  = 0;
+        busy_until    = 0;
+        stalled_ms    = 0;
+    }
+
+    void idle(uint32_t ms) {
+        advance_time(ms);
+        eeprom_write_back_task();
+    }
+};
+
+TEST_F(EepromWriteBack, ReadsSeePendingWrites) {
+    uint8_t data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t read[16];
+
+    eeprom_write_block(data, (void *)60, sizeof(data));
+    EXPECT_EQ(page_programs, 0);
+    EXPECT_TRUE(eeprom_write_back_pending());
+
+    eeprom_read_block(read, (void *)56, sizeof(read));
+    for (size_t i = 0; i < sizeof(read); ++i) {
+        uint8_t expected = (i >= 4 && i < 12) ? data[i - 4] : (uint8_t)((56 + i) * 13);
+        EXPECT_EQ(read[i], expected) << "Mismatch at offset " << i;
+    }
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)63), 4);
+
+    eeprom_write_back_flush();
+    EXPECT_FALSE(eeprom_write_back_pending());
+    // Straddles a page boundary, so takes one program cycle per page
+    EXPECT_EQ(page_programs, 2);
+    EXPECT_TRUE(std::equal(data, data + sizeof(data), &device[60]));
+}
+
+TEST_F(EepromWriteBack, ReadsWithinPendingWritesSkipDevice) {
+    eeprom_write_dword((uint32_t *)0, 0x12345678);
+    device_reads = 0;
+    EXPECT_EQ(eeprom_read_dword((const uint32_t *)0), 0x12345678);
+    EXPECT_EQ(eeprom_read_word((const uint16_t *)2), 0x1234);
+    EXPECT_EQ(device_reads, 0);
+}
+
+TEST_F(EepromWriteBack, GapsAreFilledFromDevice) {
+    std::array<uint8_t, MOCK_EEPROM_SIZE> expected = device;
+
+    eeprom_write_byte((uint8_t *)40, 0xAA);
+    eeprom_write_byte((uint8_t *)36, 0xBB);
+    eeprom_write_byte((uint8_t *)44, 0xCC);
+    expected[40] = 0xAA;
+    expected[36] = 0xBB;
+    expected[44] = 0xCC;
+
+    eeprom_write_back_flush();
+    EXPECT_EQ(page_programs, 1);
+    EXPECT_EQ(device, expected);
+}
+
+TEST_F(EepromWriteBack, FlushIsLazy) {
+    for (int page = 0; page < 3; ++page) {
+        eeprom_write_byte((uint8_t *)(uintptr_t)(page * EEPROM_WRITE_BACK_PAGE_SIZE), 0x55);
+    }
+
+    idle(EEPROM_WRITE_BACK_IDLE_TIMEOUT - 1);
+    EXPECT_EQ(page_programs, 0);
+
+    // One page per task invocation, oldest first
+    idle(1);
+    EXPECT_EQ(page_programs, 1);
+    EXPECT_EQ(device[0], 0x55);
+    EXPECT_EQ(device[EEPROM_WRITE_BACK_PAGE_SIZE], (uint8_t)(EEPROM_WRITE_BACK_PAGE_SIZE * 13));
+
+    // Nothing is handed to the device until it has finished programming
+    idle(MOCK_WRITE_TIME_MS - 1);
+    EXPECT_EQ(page_programs, 1);
+    idle(1);
+    idle(MOCK_WRITE_TIME_MS);
+    EXPECT_EQ(page_programs, 3);
+    EXPECT_FALSE(eeprom_write_back_pending());
+    EXPECT_EQ(stalled_ms, 0);
+
+    // Further writes restart the idle timeout
+    eeprom_write_byte((uint8_t *)1, 0x66);
+    eeprom_write_back_task();
+    EXPECT_EQ(page_programs, 3);
+}
+
+TEST_F(EepromWriteBack, OldestLineIsEvicted) {
+    for (int page = 0; page <= EEPROM_WRITE_BACK_LINES; ++page) {
+        eeprom_write_byte((uint8_t *)(uintptr_t)(page * EEPROM_WRITE_BACK_PAGE_SIZE + 1), 0x77);
+    }
+
+    EXPECT_EQ(page_programs, 1);
+    EXPECT_EQ(device[1], 0x77);
+    EXPECT_EQ(device[EEPROM_WRITE_BACK_PAGE_SIZE + 1], (uint8_t)((EEPROM_WRITE_BACK_PAGE_SIZE + 1) * 13));
+}
+
+TEST_F(EepromWriteBack, UpdatesOfUnchangedDataAreSkipped) {
+    eeprom_update_byte((uint8_t *)5, (uint8_t)(5 * 13));
+    EXPECT_FALSE(eeprom_write_back_pending());
+
+    eeprom_update_byte((uint8_t *)5, 0);
+    eeprom_update_byte((uint8_t *)5, 0);
+    eeprom_write_back_flush();
+    EXPECT_EQ(page_programs, 1);
+}
+
+TEST_F(EepromWriteBack, BulkUpdateCost) {
+    // VIA sends the keymap buffer in chunks of 28 bytes
+    const size_t chunk = 28;
+    uint8_t      data[chunk];
+
+    for (size_t offset = 0; offset < MOCK_EEPROM_SIZE; offset += chunk) {
+        size_t length = std::min(chunk, MOCK_EEPROM_SIZE - offset);
+        memset(data, (int)offset, length);
+        eeprom_driver_write_block(data, (void *)offset, length);
+    }
+    uint32_t uncached_programs = page_programs;
+
+    page_programs = 0;
+    for (size_t offset = 0; offset < MOCK_EEPROM_SIZE; offset += chunk) {
+        size_t length = std::min(chunk, MOCK_EEPROM_SIZE - offset);
+        memset(data, (int)~offset, length);
+        eeprom_write_block(data, (void *)offset, length);
+    }
+    eeprom_write_back_flush();
+    uint32_t cached_programs = page_programs;
+
+    // Every page is programmed exactly once
+    EXPECT_EQ(cached_programs, MOCK_EEPROM_SIZE / EEPROM_WRITE_BACK_PAGE_SIZE);
+    EXPECT_GT(uncached_programs, cached_programs);
+    EXPECT_EQ(device[MOCK_EEPROM_SIZE - 1], (uint8_t)~((MOCK_EEPROM_SIZE - 1) / chunk * chunk));
+
+    RecordProperty("uncached_write_ms", std::to_string(uncached_programs * MOCK_WRITE_TIME_MS));
+    RecordProperty("cached_write_ms", std::to_string(cached_programs * MOCK_WRITE_TIME_MS));
+}
+
+TEST_F(EepromWriteBack, BulkUpdateDoesNotStall) {
+    const size_t chunk = 28;
+    uint8_t      data[chunk];
+
+    // A host sending a packet every other scan, with scans taking a millisecond
+    auto bulk_update = [&](bool cached) {
+        for (size_t offset = 0; offset < MOCK_EEPROM_SIZE; offset += chunk) {
+            size_t length = std::min(chunk, MOCK_EEPROM_SIZE - offset);
+            memset(data, (int)(offset ^ cached), length);
+            if (cached) {
+                eeprom_write_block(data, (void *)offset, length);
+            } else {
+                eeprom_driver_write_block(data, (void *)offset, length);
+            }
+            for (int scan = 0; scan < 2; ++scan) {
+                idle(1);
+            }
+        }
+    };
+
+    bulk_update(false);
+    uint32_t uncached_stall = stalled_ms;
+
+    stalled_ms = 0;
+    bulk_update(true);
+    uint32_t cached_stall = stalled_ms;
+    while (eeprom_write_back_pending()) {
+        idle(1);
+    }
+
+    EXPECT_EQ(stalled_ms, cached_stall);
+    // The device can't program pages any faster, but only half as many are written and the keyboard only waits for
+    // them once all lines are in use
+    EXPECT_LT(cached_stall * 3, uncached_stall);
+    EXPECT_EQ(device[MOCK_EEPROM_SIZE - 1], (uint8_t)(((MOCK_EEPROM_SIZE - 1) / chunk * chunk) ^ 1));
+
+    RecordProperty("uncached_stall_ms", std::to_string(uncached_stall));
+    RecordProperty("cached_stall_ms", std::to_string(cached_stall));
+}
@@ -23,3 +23,17 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+eeprom_write_back_DEFS := \
+	-DEEPROM_TEST_HARNESS \
+	-DEEPROM_WRITE_BACK_ENABLE \
+	-DEEPROM_WRITE_BACK_PAGE_SIZE=32 \
+	-DEEPROM_WRITE_BACK_LINES=4 \
+	-DEEPROM_WRITE_BACK_IDLE_TIMEOUT=250
+eeprom_write_back_SRC := \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_write_back.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_write_back_tests.cpp
+eeprom_write_back_INC := \
+	$(TOP_DIR)/drivers/eeprom/
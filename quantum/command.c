@@ -46,6 +46,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "audio.h"
 #endif /* AUDIO_ENABLE */
 
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_STATISTICS)
+#    include "wear_leveling.h"
+#endif
+
 static bool command_common(uint8_t code);
 static void command_common_help(void);
 static void print_version(void);
@@ -228,6 +232,7 @@ static void print_status(void) {
         "keymap_config.nkro: %02X\n"
 #endif
         "timer_read32(): %08lX\n"
+        "boot phases (ms): critical %lu, first scan %lu, first report %lu, complete %lu\n"
 
         , host_keyboard_leds()
         , keyboard_protocol
@@ -236,6 +241,10 @@ static void print_status(void) {
         , keymap_config.nkro
 #endif
         , timer_read32()
+        , keyboard_boot_phase_time(BOOT_PHASE_CRITICAL)
+        , keyboard_boot_phase_time(BOOT_PHASE_FIRST_SCAN)
+        , keyboard_boot_phase_time(BOOT_PHASE_FIRST_REPORT)
+        , keyboard_boot_phase_time(BOOT_PHASE_COMPLETE)
 
     ); /* clang-format on */
 }
@@ -310,6 +319,35 @@ static void print_eeconfig(void) {
     ); /* clang-format on */
 
 #    endif /* BACKLIGHT_ENABLE */
+
+#    if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_STATISTICS)
+
+    wear_leveling_statistics_t wls;
+    wear_leveling_get_statistics(&wls);
+    xprintf(/* clang-format off */
+        "wear_leveling:\n"
+
+        ".writes: %lu\n"
+        ".skipped_writes: %lu\n"
+        ".log_entries: %lu\n"
+        ".bytes_logged: %lu\n"
+        ".optimized_entries: %lu\n"
+        ".consolidations: %lu\n"
+        ".erases: %lu\n"
+        ".blocked_ms: %lu\n"
+
+        , (unsigned long)wls.writes
+        , (unsigned long)wls.skipped_writes
+        , (unsigned long)wls.log_entries
+        , (unsigned long)wls.bytes_logged
+        , (unsigned long)wls.optimized_entries
+        , (unsigned long)wls.consolidations
+        , (unsigned long)wls.erases
+        , (unsigned long)wls.blocked_ms
+
+    ); /* clang-format on */
+
+#    endif /* WEAR_LEVELING_ENABLE && WEAR_LEVELING_STATISTICS */
 }
 #endif /* !NO_PRINT && !USER_PRINT */
 
@@ -1,9 +1,12 @@
 #include <string.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "eeprom.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "keyboard.h"
+#include "timer.h"
 
 #if defined(EEPROM_DRIVER)
 #    include "eeprom_driver.h"
@@ -19,6 +22,247 @@ void via_eeprom_set_valid(bool valid);
 void eeconfig_init_via(void);
 #endif
 
+_Static_assert(sizeof(eeconfig_t) == (EECONFIG_BASE_SIZE), "EECONFIG_BASE_SIZE does not match EECONFIG_RECORDS");
+_Static_assert(offsetof(eeconfig_t, rgblight_extended) == 36, "Existing eeconfig records must not move");
+
+#define EECONFIG_RECORD_ENTRY(id, name, type) [EECONFIG_RECORD_##id] = {offsetof(eeconfig_t, name), sizeof(type)},
+
+static const struct {
+    uint8_t offset;
+    uint8_t size;
+} eeconfig_records[EECONFIG_RECORD_COUNT] = {EECONFIG_RECORDS(EECONFIG_RECORD_ENTRY)};
+
+typedef struct eeconfig_deferred_block_t {
+    const void *source;
+    void       *addr;
+    size_t      len;
+} eeconfig_deferred_block_t;
+
+typedef void (*eeconfig_flush_callback_t)(void);
+
+static eeconfig_t                eeconfig_cache;
+static bool                      eeconfig_loaded;
+static uint8_t                   eeconfig_batch_depth;
+static uint8_t                   eeconfig_dirty_start = (EECONFIG_BASE_SIZE);
+static uint8_t                   eeconfig_dirty_end   = 0;
+static eeconfig_deferred_block_t eeconfig_deferred_blocks[EECONFIG_DEFERRED_BLOCKS];
+static uint8_t                   eeconfig_deferred_count;
+static eeconfig_flush_callback_t eeconfig_flush_callbacks[EECONFIG_FLUSH_CALLBACKS];
+static uint8_t                   eeconfig_flush_callback_count;
+static uint32_t                  eeconfig_last_update;
+static uint32_t                  eeconfig_first_update;
+
+/** \brief Load the core configuration from EEPROM into RAM
+ *
+ * Any updates which haven't been flushed yet are lost.
+ */
+void eeconfig_load(void) {
+    eeprom_read_block(&eeconfig_cache, EECONFIG_MAGIC, sizeof(eeconfig_cache));
+    eeconfig_loaded         = true;
+    eeconfig_dirty_start    = (EECONFIG_BASE_SIZE);
+    eeconfig_dirty_end      = 0;
+    eeconfig_deferred_count = 0;
+
+    eeconfig_flush_callback_count = 0;
+}
+
+static const eeconfig_t *eeconfig_get(void) {
+    if (!eeconfig_loaded) {
+        eeconfig_load();
+    }
+    return &eeconfig_cache;
+}
+
+/** \brief Whether any updates are still waiting to be written to EEPROM
+ */
+bool eeconfig_flush_pending(void) {
+    return eeconfig_dirty_end > eeconfig_dirty_start || eeconfig_deferred_count > 0 || eeconfig_flush_callback_count > 0;
+}
+
+/** \brief Note the time of a deferred update, and of the first one since the last flush
+ */
+static void eeconfig_mark_deferred(void) {
+    eeconfig_last_update = timer_read32();
+    if (!eeconfig_flush_pending()) {
+        eeconfig_first_update = eeconfig_last_update;
+    }
+}
+
+/** \brief Write every pending update to EEPROM
+ *
+ * All changed records of the core configuration go out as a single block.
+ */
+void eeconfig_flush(void) {
+    if (eeconfig_dirty_end > eeconfig_dirty_start) {
+        uint8_t *cache = (uint8_t *)&eeconfig_cache;
+        eeprom_update_block(&cache[eeconfig_dirty_start], (void *)(uintptr_t)eeconfig_dirty_start, eeconfig_dirty_end - eeconfig_dirty_start);
+    }
+    eeconfig_dirty_start = (EECONFIG_BASE_SIZE);
+    eeconfig_dirty_end   = 0;
+
+    for (uint8_t i = 0; i < eeconfig_deferred_count; i++) {
+        eeprom_update_block(eeconfig_deferred_blocks[i].source, eeconfig_deferred_blocks[i].addr, eeconfig_deferred_blocks[i].len);
+    }
+    eeconfig_deferred_count = 0;
+
+    // Cleared first, so that callbacks are free to queue further updates
+    uint8_t count                 = eeconfig_flush_callback_count;
+    eeconfig_flush_callback_count = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        eeconfig_flush_callbacks[i]();
+    }
+}
+
+/** \brief Flush pending updates once neither they nor the user's input have changed for EECONFIG_FLUSH_TIMEOUT
+ *
+ * Constant changes or input only hold them back for up to EECONFIG_FLUSH_MAX_DELAY.
+ */
+void eeconfig_task(void) {
+    if (!eeconfig_flush_pending() || eeconfig_batch_depth > 0) {
+        return;
+    }
+    if (timer_elapsed32(eeconfig_last_update) >= EECONFIG_FLUSH_TIMEOUT && last_input_activity_elapsed() >= EECONFIG_FLUSH_TIMEOUT) {
+        eeconfig_flush();
+    } else if (timer_elapsed32(eeconfig_first_update) >= EECONFIG_FLUSH_MAX_DELAY) {
+        eeconfig_flush();
+    }
+}
+
+/** \brief Read a block, serving the part within the core configuration from RAM
+ */
+void eeconfig_read_block(void *buf, const void *addr, size_t len) {
+    const uint8_t *cache  = (const uint8_t *)eeconfig_get();
+    uintptr_t      offset = (uintptr_t)addr;
+
+    if (offset < (EECONFIG_BASE_SIZE)) {
+        size_t cached = len < (EECONFIG_BASE_SIZE)-offset ? len : (EECONFIG_BASE_SIZE)-offset;
+        memcpy(buf, &cache[offset], cached);
+        buf = (uint8_t *)buf + cached;
+        offset += cached;
+        len -= cached;
+    }
+    if (len > 0) {
+        eeprom_read_block(buf, (const void *)offset, len);
+    }
+}
+
+/**
+ * @brief Apply the part of an update within the core configuration to the RAM copy.
+ *
+ * @return the length of that part, which is marked dirty if it changed
+ */
+static size_t eeconfig_update_cache(const void *buf, uintptr_t offset, size_t len) {
+    uint8_t *cache = (uint8_t *)eeconfig_get();
+    if (offset >= (EECONFIG_BASE_SIZE)) {
+        return 0;
+    }
+
+    size_t cached = len < (EECONFIG_BASE_SIZE)-offset ? len : (EECONFIG_BASE_SIZE)-offset;
+    if (memcmp(&cache[offset], buf, cached) != 0) {
+        memcpy(&cache[offset], buf, cached);
+        if (offset < eeconfig_dirty_start) {
+            eeconfig_dirty_start = offset;
+        }
+        if (offset + cached > eeconfig_dirty_end) {
+            eeconfig_dirty_end = offset + cached;
+        }
+    }
+    return cached;
+}
+
+/** \brief Update a block, writing through the RAM copy of the core configuration
+ *
+ * Unchanged parts of the core configuration are skipped. Changed ones are
+ * written along with all other pending updates, unless a batch is open.
+ */
+void eeconfig_update_block(const void *buf, void *addr, size_t len) {
+    size_t cached = eeconfig_update_cache(buf, (uintptr_t)addr, len);
+    if (len > cached) {
+        eeprom_update_block((const uint8_t *)buf + cached, (uint8_t *)addr + cached, len - cached);
+    }
+    if (eeconfig_batch_depth == 0) {
+        eeconfig_flush();
+    }
+}
+
+/** \brief Update a block, leaving the write to EEPROM to eeconfig_task()
+ *
+ * Outside of the core configuration, only a reference to the data is kept --
+ * it has to stay valid until flushed, and reads through eeconfig_read_block()
+ * see the previous contents until then.
+ */
+void eeconfig_update_block_deferred(const void *buf, void *addr, size_t len) {
+    eeconfig_mark_deferred();
+    size_t cached = eeconfig_update_cache(buf, (uintptr_t)addr, len);
+    if (len == cached) {
+        return;
+    }
+
+    const void *source = (const uint8_t *)buf + cached;
+    addr               = (uint8_t *)addr + cached;
+    len -= cached;
+    for (uint8_t i = 0; i < eeconfig_deferred_count; i++) {
+        if (eeconfig_deferred_blocks[i].addr == addr && eeconfig_deferred_blocks[i].len == len) {
+            eeconfig_deferred_blocks[i].source = source;
+            return;
+        }
+    }
+    if (eeconfig_deferred_count == (EECONFIG_DEFERRED_BLOCKS)) {
+        eeconfig_flush();
+    }
+    eeconfig_deferred_blocks[eeconfig_deferred_count++] = (eeconfig_deferred_block_t){source, addr, len};
+}
+
+/** \brief Call the callback once the pending updates have been written to EEPROM
+ *
+ * Nothing needs to be pending -- the callback then runs with the next flush.
+ */
+void eeconfig_notify_flush(void (*callback)(void)) {
+    eeconfig_mark_deferred();
+    for (uint8_t i = 0; i < eeconfig_flush_callback_count; i++) {
+        if (eeconfig_flush_callbacks[i] == callback) {
+            return;
+        }
+    }
+    if (eeconfig_flush_callback_count == (EECONFIG_FLUSH_CALLBACKS)) {
+        eeconfig_flush();
+    }
+    eeconfig_flush_callbacks[eeconfig_flush_callback_count++] = callback;
+}
+
+/** \brief Read a single record of the core configuration
+ */
+void eeconfig_read_record(eeconfig_record_t record, void *data) {
+    eeconfig_read_block(data, (const void *)(uintptr_t)eeconfig_records[record].offset, eeconfig_records[record].size);
+}
+
+/** \brief Update a single record of the core configuration
+ */
+void eeconfig_update_record(eeconfig_record_t record, const void *data) {
+    eeconfig_update_block(data, (void *)(uintptr_t)eeconfig_records[record].offset, eeconfig_records[record].size);
+}
+
+/** \brief Update a single record of the core configuration, leaving the write to eeconfig_task()
+ */
+void eeconfig_update_record_deferred(eeconfig_record_t record, const void *data) {
+    eeconfig_update_block_deferred(data, (void *)(uintptr_t)eeconfig_records[record].offset, eeconfig_records[record].size);
+}
+
+/** \brief Hold back updates until eeconfig_batch_end()
+ */
+void eeconfig_batch_begin(void) {
+    eeconfig_batch_depth++;
+}
+
+/** \brief Write all pending updates at the end of the outermost batch
+ */
+void eeconfig_batch_end(void) {
+    if (eeconfig_batch_depth == 0 || --eeconfig_batch_depth > 0) {
+        return;
+    }
+    eeconfig_flush();
+}
+
 /** \brief eeconfig enable
  *
  * FIXME: needs doc
@@ -46,26 +290,31 @@ void eeconfig_init_quantum(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
 #endif
+    // Whatever the erase left behind
+    eeconfig_load();
 
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
-    eeprom_update_byte(EECONFIG_DEBUG, 0);
+    eeconfig_batch_begin();
+    uint16_t magic = EECONFIG_MAGIC_NUMBER;
+    eeconfig_update_record(EECONFIG_RECORD_MAGIC, &magic);
+    eeconfig_update_debug(0);
     default_layer_state = (layer_state_t)1 << 0;
-    eeprom_update_byte(EECONFIG_DEFAULT_LAYER, default_layer_state);
+    eeconfig_update_default_layer(default_layer_state);
     // Enable oneshot and autocorrect by default: 0b0001 0100 0000 0000
-    eeprom_update_word(EECONFIG_KEYMAP, 0x1400);
-    eeprom_update_byte(EECONFIG_BACKLIGHT, 0);
-    eeprom_update_byte(EECONFIG_AUDIO, 0);
-    eeprom_update_dword(EECONFIG_RGBLIGHT, 0);
-    eeprom_update_byte(EECONFIG_RGBLIGHT_EXTENDED, 0);
-    eeprom_update_byte(EECONFIG_UNUSED, 0);
-    eeprom_update_byte(EECONFIG_UNICODEMODE, 0);
-    eeprom_update_byte(EECONFIG_STENOMODE, 0);
-    uint64_t dummy = 0;
-    eeprom_update_block(&dummy, EECONFIG_RGB_MATRIX, sizeof(uint64_t));
-    eeprom_update_dword(EECONFIG_HAPTIC, 0);
+    eeconfig_update_keymap(0x1400);
+    uint64_t zero = 0;
+    eeconfig_update_record(EECONFIG_RECORD_BACKLIGHT, &zero);
+    eeconfig_update_record(EECONFIG_RECORD_AUDIO, &zero);
+    eeconfig_update_record(EECONFIG_RECORD_RGBLIGHT, &zero);
+    eeconfig_update_record(EECONFIG_RECORD_RGBLIGHT_EXTENDED, &zero);
+    eeconfig_update_record(EECONFIG_RECORD_UNUSED, &zero);
+    eeconfig_update_record(EECONFIG_RECORD_UNICODEMODE, &zero);
+    eeconfig_update_record(EECONFIG_RECORD_STENOMODE, &zero);
+    eeconfig_update_record(EECONFIG_RECORD_MATRIX, &zero);
+    eeconfig_update_record(EECONFIG_RECORD_HAPTIC, &zero);
 #if defined(HAPTIC_ENABLE)
     haptic_reset();
 #endif
+    eeconfig_batch_end();
 
 #if (EECONFIG_KB_DATA_SIZE) > 0
     eeconfig_init_kb_datablock();
@@ -99,7 +348,8 @@ void eeconfig_init(void) {
  * FIXME: needs doc
  */
 void eeconfig_enable(void) {
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    uint16_t magic = EECONFIG_MAGIC_NUMBER;
+    eeconfig_update_record(EECONFIG_RECORD_MAGIC, &magic);
 }
 
 /** \brief eeconfig disable
@@ -110,7 +360,9 @@ void eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
 #endif
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+    eeconfig_load();
+    uint16_t magic = EECONFIG_MAGIC_NUMBER_OFF;
+    eeconfig_update_record(EECONFIG_RECORD_MAGIC, &magic);
 }
 
 /** \brief eeconfig is enabled
@@ -118,7 +370,7 @@ void eeconfig_disable(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_enabled(void) {
-    bool is_eeprom_enabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
+    bool is_eeprom_enabled = (eeconfig_get()->magic == EECONFIG_MAGIC_NUMBER);
 #ifdef VIA_ENABLE
     if (is_eeprom_enabled) {
         is_eeprom_enabled = via_eeprom_is_valid();
@@ -132,7 +384,7 @@ bool eeconfig_is_enabled(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_disabled(void) {
-    bool is_eeprom_disabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
+    bool is_eeprom_disabled = (eeconfig_get()->magic == EECONFIG_MAGIC_NUMBER_OFF);
 #ifdef VIA_ENABLE
     if (!is_eeprom_disabled) {
         is_eeprom_disabled = !via_eeprom_is_valid();
@@ -146,14 +398,14 @@ bool eeconfig_is_disabled(void) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_debug(void) {
-    return eeprom_read_byte(EECONFIG_DEBUG);
+    return eeconfig_get()->debug;
 }
 /** \brief eeconfig update debug
  *
  * FIXME: needs doc
  */
 void eeconfig_update_debug(uint8_t val) {
-    eeprom_update_byte(EECONFIG_DEBUG, val);
+    eeconfig_update_record(EECONFIG_RECORD_DEBUG, &val);
 }
 
 /** \brief eeconfig read default layer
@@ -161,14 +413,14 @@ void eeconfig_update_debug(uint8_t val) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_default_layer(void) {
-    return eeprom_read_byte(EECONFIG_DEFAULT_LAYER);
+    return eeconfig_get()->default_layer;
 }
 /** \brief eeconfig update default layer
  *
  * FIXME: needs doc
  */
 void eeconfig_update_default_layer(uint8_t val) {
-    eeprom_update_byte(EECONFIG_DEFAULT_LAYER, val);
+    eeconfig_update_record(EECONFIG_RECORD_DEFAULT_LAYER, &val);
 }
 
 /** \brief eeconfig read keymap
@@ -176,14 +428,14 @@ void eeconfig_update_default_layer(uint8_t val) {
  * FIXME: needs doc
  */
 uint16_t eeconfig_read_keymap(void) {
-    return eeprom_read_word(EECONFIG_KEYMAP);
+    return eeconfig_get()->keymap;
 }
 /** \brief eeconfig update keymap
  *
  * FIXME: needs doc
  */
 void eeconfig_update_keymap(uint16_t val) {
-    eeprom_update_word(EECONFIG_KEYMAP, val);
+    eeconfig_update_record_deferred(EECONFIG_RECORD_KEYMAP, &val);
 }
 
 /** \brief eeconfig read audio
@@ -191,14 +443,14 @@ void eeconfig_update_keymap(uint16_t val) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_audio(void) {
-    return eeprom_read_byte(EECONFIG_AUDIO);
+    return eeconfig_get()->audio;
 }
 /** \brief eeconfig update audio
  *
  * FIXME: needs doc
  */
 void eeconfig_update_audio(uint8_t val) {
-    eeprom_update_byte(EECONFIG_AUDIO, val);
+    eeconfig_update_record_deferred(EECONFIG_RECORD_AUDIO, &val);
 }
 
 #if (EECONFIG_KB_DATA_SIZE) == 0
@@ -207,14 +459,14 @@ void eeconfig_update_audio(uint8_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_kb(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD);
+    return eeconfig_get()->keyboard;
 }
 /** \brief eeconfig update kb
  *
  * FIXME: needs doc
  */
 void eeconfig_update_kb(uint32_t val) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, val);
+    eeconfig_update_record(EECONFIG_RECORD_KEYBOARD, &val);
 }
 #endif // (EECONFIG_KB_DATA_SIZE) == 0
 
@@ -224,14 +476,14 @@ void eeconfig_update_kb(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_user(void) {
-    return eeprom_read_dword(EECONFIG_USER);
+    return eeconfig_get()->user;
 }
 /** \brief eeconfig update user
  *
  * FIXME: needs doc
  */
 void eeconfig_update_user(uint32_t val) {
-    eeprom_update_dword(EECONFIG_USER, val);
+    eeconfig_update_record(EECONFIG_RECORD_USER, &val);
 }
 #endif // (EECONFIG_USER_DATA_SIZE) == 0
 
@@ -240,14 +492,14 @@ void eeconfig_update_user(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_haptic(void) {
-    return eeprom_read_dword(EECONFIG_HAPTIC);
+    return eeconfig_get()->haptic;
 }
 /** \brief eeconfig update haptic
  *
  * FIXME: needs doc
  */
 void eeconfig_update_haptic(uint32_t val) {
-    eeprom_update_dword(EECONFIG_HAPTIC, val);
+    eeconfig_update_record_deferred(EECONFIG_RECORD_HAPTIC, &val);
 }
 
 /** \brief eeconfig read split handedness
@@ -255,14 +507,15 @@ void eeconfig_update_haptic(uint32_t val) {
  * FIXME: needs doc
  */
 bool eeconfig_read_handedness(void) {
-    return !!eeprom_read_byte(EECONFIG_HANDEDNESS);
+    return !!eeconfig_get()->handedness;
 }
 /** \brief eeconfig update split handedness
  *
  * FIXME: needs doc
  */
 void eeconfig_update_handedness(bool val) {
-    eeprom_update_byte(EECONFIG_HANDEDNESS, !!val);
+    uint8_t handedness = !!val;
+    eeconfig_update_record(EECONFIG_RECORD_HANDEDNESS, &handedness);
 }
 
 #if (EECONFIG_KB_DATA_SIZE) > 0
@@ -271,7 +524,7 @@ void eeconfig_update_handedness(bool val) {
  * FIXME: needs doc
  */
 bool eeconfig_is_kb_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
+    return eeconfig_get()->keyboard == (EECONFIG_KB_DATA_VERSION);
 }
 /** \brief eeconfig read keyboard data block
  *
@@ -289,7 +542,8 @@ void eeconfig_read_kb_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_kb_datablock(const void *data) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
+    uint32_t version = (EECONFIG_KB_DATA_VERSION);
+    eeconfig_update_record(EECONFIG_RECORD_KEYBOARD, &version);
     eeprom_update_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
 }
 /** \brief eeconfig init keyboard data block
@@ -308,7 +562,7 @@ __attribute__((weak)) void eeconfig_init_kb_datablock(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_user_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
+    return eeconfig_get()->user == (EECONFIG_USER_DATA_VERSION);
 }
 /** \brief eeconfig read user data block
  *
@@ -326,7 +580,8 @@ void eeconfig_read_user_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_user_datablock(const void *data) {
-    eeprom_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
+    uint32_t version = (EECONFIG_USER_DATA_VERSION);
+    eeconfig_update_record(EECONFIG_RECORD_USER, &version);
     eeprom_update_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
 }
 /** \brief eeconfig init user data block
@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "eeprom.h"
 
 #ifndef EECONFIG_MAGIC_NUMBER
@@ -26,29 +27,85 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #endif
 #define EECONFIG_MAGIC_NUMBER_OFF (uint16_t)0xFFFF
 
+// Quiet period, both since the last deferred update and the last input, after which pending updates are written
+#ifndef EECONFIG_FLUSH_TIMEOUT
+#    define EECONFIG_FLUSH_TIMEOUT 5000
+#endif
+// Longest time a deferred update is held back, even if the configuration or the user's input keeps changing
+#ifndef EECONFIG_FLUSH_MAX_DELAY
+#    define EECONFIG_FLUSH_MAX_DELAY 60000
+#endif
+// Number of deferred updates outside of the core configuration which can be pending at once
+#ifndef EECONFIG_DEFERRED_BLOCKS
+#    define EECONFIG_DEFERRED_BLOCKS 2
+#endif
+// Number of callbacks which can be waiting for pending updates to be written
+#ifndef EECONFIG_FLUSH_CALLBACKS
+#    define EECONFIG_FLUSH_CALLBACKS 2
+#endif
+
+/* Records of the core configuration, in storage order. The offset and size of
+ * each record is derived from this list -- new records are appended at the
+ * end, and EECONFIG_BASE_SIZE bumped to match.
+ */
+// clang-format off
+#define EECONFIG_RECORDS(X)                          \
+    X(MAGIC,             magic,             uint16_t) \
+    X(DEBUG,             debug,             uint8_t)  \
+    X(DEFAULT_LAYER,     default_layer,     uint8_t)  \
+    X(KEYMAP,            keymap,            uint16_t) \
+    X(BACKLIGHT,         backlight,         uint8_t)  \
+    X(AUDIO,             audio,             uint8_t)  \
+    X(RGBLIGHT,          rgblight,          uint32_t) \
+    X(UNICODEMODE,       unicodemode,       uint8_t)  \
+    X(STENOMODE,         stenomode,         uint8_t)  \
+    X(HANDEDNESS,        handedness,        uint8_t)  \
+    X(KEYBOARD,          keyboard,          uint32_t) \
+    X(USER,              user,              uint32_t) \
+    X(UNUSED,            unused,            uint8_t)  \
+    X(MATRIX,            matrix,            uint64_t) \
+    X(HAPTIC,            haptic,            uint32_t) \
+    X(RGBLIGHT_EXTENDED, rgblight_extended, uint8_t)
+// clang-format on
+
+#define EECONFIG_RECORD_FIELD(id, name, type) type name;
+#define EECONFIG_RECORD_ID(id, name, type) EECONFIG_RECORD_##id,
+
+typedef struct __attribute__((packed)) eeconfig_t {
+    EECONFIG_RECORDS(EECONFIG_RECORD_FIELD)
+} eeconfig_t;
+
+typedef enum eeconfig_record_t {
+    EECONFIG_RECORDS(EECONFIG_RECORD_ID)
+    // Number of records
+    EECONFIG_RECORD_COUNT
+} eeconfig_record_t;
+
+#define EECONFIG_RECORD_ADDR(type, name) ((type *)offsetof(eeconfig_t, name))
+
 /* EEPROM parameter address */
-#define EECONFIG_MAGIC (uint16_t *)0
-#define EECONFIG_DEBUG (uint8_t *)2
-#define EECONFIG_DEFAULT_LAYER (uint8_t *)3
-#define EECONFIG_KEYMAP (uint16_t *)4
-#define EECONFIG_BACKLIGHT (uint8_t *)6
-#define EECONFIG_AUDIO (uint8_t *)7
-#define EECONFIG_RGBLIGHT (uint32_t *)8
-#define EECONFIG_UNICODEMODE (uint8_t *)12
-#define EECONFIG_STENOMODE (uint8_t *)13
+#define EECONFIG_MAGIC EECONFIG_RECORD_ADDR(uint16_t, magic)
+#define EECONFIG_DEBUG EECONFIG_RECORD_ADDR(uint8_t, debug)
+#define EECONFIG_DEFAULT_LAYER EECONFIG_RECORD_ADDR(uint8_t, default_layer)
+#define EECONFIG_KEYMAP EECONFIG_RECORD_ADDR(uint16_t, keymap)
+#define EECONFIG_BACKLIGHT EECONFIG_RECORD_ADDR(uint8_t, backlight)
+#define EECONFIG_AUDIO EECONFIG_RECORD_ADDR(uint8_t, audio)
+#define EECONFIG_RGBLIGHT EECONFIG_RECORD_ADDR(uint32_t, rgblight)
+#define EECONFIG_UNICODEMODE EECONFIG_RECORD_ADDR(uint8_t, unicodemode)
+#define EECONFIG_STENOMODE EECONFIG_RECORD_ADDR(uint8_t, stenomode)
 // EEHANDS for two handed boards
-#define EECONFIG_HANDEDNESS (uint8_t *)14
-#define EECONFIG_KEYBOARD (uint32_t *)15
-#define EECONFIG_USER (uint32_t *)19
-#define EECONFIG_UNUSED (uint8_t *)23
+#define EECONFIG_HANDEDNESS EECONFIG_RECORD_ADDR(uint8_t, handedness)
+#define EECONFIG_KEYBOARD EECONFIG_RECORD_ADDR(uint32_t, keyboard)
+#define EECONFIG_USER EECONFIG_RECORD_ADDR(uint32_t, user)
+#define EECONFIG_UNUSED EECONFIG_RECORD_ADDR(uint8_t, unused)
 // Mutually exclusive
-#define EECONFIG_LED_MATRIX (uint32_t *)24
-#define EECONFIG_RGB_MATRIX (uint64_t *)24
+#define EECONFIG_LED_MATRIX EECONFIG_RECORD_ADDR(uint32_t, matrix)
+#define EECONFIG_RGB_MATRIX EECONFIG_RECORD_ADDR(uint64_t, matrix)
 
-#define EECONFIG_HAPTIC (uint32_t *)32
-#define EECONFIG_RGBLIGHT_EXTENDED (uint8_t *)36
+#define EECONFIG_HAPTIC EECONFIG_RECORD_ADDR(uint32_t, haptic)
+#define EECONFIG_RGBLIGHT_EXTENDED EECONFIG_RECORD_ADDR(uint8_t, rgblight_extended)
 
-// Size of EEPROM being used for core data storage
+// Size of EEPROM being used for core data storage, kept as a literal for use in preprocessor conditionals
 #define EECONFIG_BASE_SIZE 37
 
 // Size of EEPROM dedicated to keyboard- and user-specific data
@@ -87,6 +144,56 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define EECONFIG_KEYMAP_SWAP_BACKSLASH_BACKSPACE (1 << 6)
 #define EECONFIG_KEYMAP_NKRO (1 << 7)
 
+/**
+ * The core configuration is loaded into RAM in one go, and all reads of it are
+ * served from there. Loading happens on first access, eeconfig_load() reloads
+ * it from EEPROM explicitly, for instance once the EEPROM driver is ready.
+ */
+void eeconfig_load(void);
+
+/**
+ * Typed access to single records, see EECONFIG_RECORDS.
+ */
+void eeconfig_read_record(eeconfig_record_t record, void *data);
+void eeconfig_update_record(eeconfig_record_t record, const void *data);
+
+/**
+ * Equivalents of eeprom_read_block() and eeprom_update_block(), which go
+ * through the RAM copy for any part of the range within the core configuration.
+ */
+void eeconfig_read_block(void *buf, const void *addr, size_t len);
+void eeconfig_update_block(const void *buf, void *addr, size_t len);
+
+/**
+ * Updates between these calls are only written to EEPROM once the outermost
+ * batch ends, with all changed records as a single block.
+ */
+void eeconfig_batch_begin(void);
+void eeconfig_batch_end(void);
+
+/**
+ * Deferred updates are only applied to the RAM copy, and written by
+ * eeconfig_task() once nothing changed for EECONFIG_FLUSH_TIMEOUT, or at the
+ * latest after EECONFIG_FLUSH_MAX_DELAY -- grouped with every other pending
+ * update, so that adjusting several settings in a row results in a single
+ * write. Outside of the core configuration, the data has to stay valid until
+ * it is flushed.
+ */
+void eeconfig_update_record_deferred(eeconfig_record_t record, const void *data);
+void eeconfig_update_block_deferred(const void *buf, void *addr, size_t len);
+void eeconfig_task(void);
+
+/**
+ * Calls the callback once the pending updates have been written.
+ */
+void eeconfig_notify_flush(void (*callback)(void));
+
+/**
+ * Write all pending updates right away, for instance before a reset.
+ */
+void eeconfig_flush(void);
+bool eeconfig_flush_pending(void);
+
 bool eeconfig_is_enabled(void);
 bool eeconfig_is_disabled(void);
 
@@ -148,41 +255,37 @@ void eeconfig_init_user_datablock(void);
 // Any "checked" debounce variant used requires implementation of:
 //    -- bool eeconfig_check_valid_##name(void)
 //    -- void eeconfig_post_flush_##name(void)
-#define EECONFIG_DEBOUNCE_HELPER_CHECKED(name, offset, config)          \
-    static uint8_t dirty_##name = false;                                \
-                                                                        \
-    bool eeconfig_check_valid_##name(void);                             \
-    void eeconfig_post_flush_##name(void);                              \
-                                                                        \
-    static inline void eeconfig_init_##name(void) {                     \
-        dirty_##name = true;                                            \
-        if (eeconfig_check_valid_##name()) {                            \
-            eeprom_read_block(&config, offset, sizeof(config));         \
-            dirty_##name = false;                                       \
-        }                                                               \
-    }                                                                   \
-    static inline void eeconfig_flush_##name(bool force) {              \
-        if (force || dirty_##name) {                                    \
-            eeprom_update_block(&config, offset, sizeof(config));       \
-            eeconfig_post_flush_##name();                               \
-            dirty_##name = false;                                       \
-        }                                                               \
-    }                                                                   \
-    static inline void eeconfig_flush_##name##_task(uint16_t timeout) { \
-        static uint16_t flush_timer = 0;                                \
-        if (timer_elapsed(flush_timer) > timeout) {                     \
-            eeconfig_flush_##name(false);                               \
-            flush_timer = timer_read();                                 \
-        }                                                               \
-    }                                                                   \
-    static inline void eeconfig_flag_##name(bool v) {                   \
-        dirty_##name |= v;                                              \
-    }                                                                   \
-    static inline void eeconfig_write_##name(typeof(config) *conf) {    \
-        if (memcmp(&config, conf, sizeof(config)) != 0) {               \
-            memcpy(&config, conf, sizeof(config));                      \
-            eeconfig_flag_##name(true);                                 \
-        }                                                               \
+// Changes flagged for writing are handed to eeconfig_task(), which writes them
+// along with those of other modules once the configuration settles, and only
+// then calls eeconfig_post_flush_##name().
+#define EECONFIG_DEBOUNCE_HELPER_CHECKED(name, offset, config)               \
+    bool eeconfig_check_valid_##name(void);                                  \
+    void eeconfig_post_flush_##name(void);                                   \
+                                                                             \
+    static inline void eeconfig_init_##name(void) {                          \
+        if (eeconfig_check_valid_##name()) {                                 \
+            eeconfig_read_block(&config, offset, sizeof(config));            \
+        } else {                                                             \
+            eeconfig_update_block_deferred(&config, offset, sizeof(config)); \
+        }                                                                    \
+    }                                                                        \
+    static inline void eeconfig_flush_##name(bool force) {                   \
+        if (force) {                                                         \
+            eeconfig_update_block(&config, offset, sizeof(config));          \
+            eeconfig_post_flush_##name();                                    \
+        }                                                                    \
+    }                                                                        \
+    static inline void eeconfig_flag_##name(bool v) {                        \
+        if (v) {                                                             \
+            eeconfig_update_block_deferred(&config, offset, sizeof(config)); \
+            eeconfig_notify_flush(eeconfig_post_flush_##name);               \
+        }                                                                    \
+    }                                                                        \
+    static inline void eeconfig_write_##name(typeof(config) *conf) {         \
+        if (memcmp(&config, conf, sizeof(config)) != 0) {                    \
+            memcpy(&config, conf, sizeof(config));                           \
+            eeconfig_flag_##name(true);                                      \
+        }                                                                    \
     }
 
 #define EECONFIG_DEBOUNCE_HELPER(name, offset, config)     \
@@ -110,6 +110,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#ifdef WEAR_LEVELING_ENABLE
+#    include "wear_leveling.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -401,96 +404,194 @@ void quantum_init(void) {
     layer_state_set_kb((layer_state_t)layer_state);
 }
 
-/** \brief keyboard_init
+static uint32_t boot_phase_times[BOOT_PHASE_COUNT];
+static uint8_t  boot_phases_reached;
+
+/** \brief Record the time a boot phase was first reached
  *
- * FIXME: needs doc
+ * Later calls for the same phase are ignored.
  */
-void keyboard_init(void) {
-    timer_init();
-    sync_timer_init();
-#ifdef VIA_ENABLE
-    via_init();
+void keyboard_boot_phase_mark(boot_phase_t phase) {
+    if (!(boot_phases_reached & (1 << phase))) {
+        boot_phase_times[phase] = timer_read32();
+        boot_phases_reached |= 1 << phase;
+    }
+}
+
+/** \brief Milliseconds from the start of keyboard_init() to the given phase, or BOOT_PHASE_PENDING if it hasn't been reached yet
+ */
+uint32_t keyboard_boot_phase_time(boot_phase_t phase) {
+    if (!(boot_phases_reached & (1 << phase))) {
+        return BOOT_PHASE_PENDING;
+    }
+    return TIMER_DIFF_32(boot_phase_times[phase], boot_phase_times[BOOT_PHASE_INIT]);
+}
+
+#ifdef OLED_ENABLE
+static void oled_init_default(void) {
+    oled_init(OLED_ROTATION_0);
+}
 #endif
-#ifdef SPLIT_KEYBOARD
-    split_pre_init();
+#ifdef ST7565_ENABLE
+static void st7565_init_default(void) {
+    st7565_init(DISPLAY_ROTATION_0);
+}
 #endif
-#ifdef ENCODER_ENABLE
-    encoder_init();
+#if defined(NKRO_ENABLE) && defined(FORCE_NKRO)
+static void force_nkro_init(void) {
+    keymap_config.nkro = 1;
+    eeconfig_update_keymap(keymap_config.raw);
+}
 #endif
-    matrix_init();
-    quantum_init();
-    led_init_ports();
+#if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
+static void debug_matrix_scan_rate_init(void) {
+    debug_enable = true;
+}
+#endif
+
+typedef struct {
+    void (*init)(void);
+    bool deferred; // not needed to get keypresses to the host
+} init_step_t;
+
+/* Everything brought up after the matrix and keymap, in order of
+ * initialization. With BOOT_DEFERRED_INIT, keyboard_init() only runs the steps
+ * which aren't deferred, and keyboard_task() brings up the deferred ones one
+ * per scan, after which keyboard_post_init_kb() is called.
+ */
+static const init_step_t init_steps[] = {
 #ifdef BACKLIGHT_ENABLE
-    backlight_init_ports();
+    {backlight_init_ports, true},
 #endif
 #ifdef AUDIO_ENABLE
-    audio_init();
+    {audio_init, true},
 #endif
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_init();
+    {led_matrix_init, true},
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_init();
+    {rgb_matrix_init, true},
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-    unicode_input_mode_init();
+    {unicode_input_mode_init, false},
 #endif
 #if defined(CRC_ENABLE)
-    crc_init();
+    {crc_init, false},
 #endif
 #ifdef OLED_ENABLE
-    oled_init(OLED_ROTATION_0);
+    {oled_init_default, true},
 #endif
 #ifdef ST7565_ENABLE
-    st7565_init(DISPLAY_ROTATION_0);
+    {st7565_init_default, true},
 #endif
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_init();
+    {ps2_mouse_init, true},
 #endif
 #ifdef BACKLIGHT_ENABLE
-    backlight_init();
+    {backlight_init, true},
 #endif
 #ifdef RGBLIGHT_ENABLE
-    rgblight_init();
+    {rgblight_init, true},
 #endif
 #ifdef STENO_ENABLE_ALL
-    steno_init();
+    {steno_init, false},
 #endif
 #if defined(NKRO_ENABLE) && defined(FORCE_NKRO)
-    keymap_config.nkro = 1;
-    eeconfig_update_keymap(keymap_config.raw);
+    {force_nkro_init, false},
 #endif
 #ifdef DIP_SWITCH_ENABLE
-    dip_switch_init();
+    {dip_switch_init, false},
 #endif
 #ifdef JOYSTICK_ENABLE
-    joystick_init();
+    {joystick_init, false},
 #endif
 #ifdef SLEEP_LED_ENABLE
-    sleep_led_init();
+    {sleep_led_init, true},
 #endif
 #ifdef VIRTSER_ENABLE
-    virtser_init();
+    {virtser_init, false},
 #endif
 #ifdef SPLIT_KEYBOARD
-    split_post_init();
+    {split_post_init, false},
 #endif
 #ifdef POINTING_DEVICE_ENABLE
     // init after split init
-    pointing_device_init();
+    {pointing_device_init, true},
 #endif
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_init();
+    {bluetooth_init, true},
 #endif
 #ifdef HAPTIC_ENABLE
-    haptic_init();
+    {haptic_init, true},
 #endif
-
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
-    debug_enable = true;
+    {debug_matrix_scan_rate_init, false},
 #endif
+    {keyboard_post_init_kb, true}, /* Always keep this last */
+};
+
+static uint8_t init_steps_done = 0;
+
+/** \brief Whether all subsystems have been initialized
+ *
+ * Tasks of deferred subsystems are only run once this is the case.
+ */
+bool keyboard_init_complete(void) {
+    return init_steps_done == ARRAY_SIZE(init_steps);
+}
 
-    keyboard_post_init_kb(); /* Always keep this last */
+/* Runs the next step -- with BOOT_DEFERRED_INIT, the next deferred one, as
+ * keyboard_init() has already run the others.
+ */
+static void init_step_next(void) {
+#ifdef BOOT_DEFERRED_INIT
+    while (!init_steps[init_steps_done].deferred) {
+        ++init_steps_done;
+    }
+#endif
+    init_steps[init_steps_done++].init();
+    if (keyboard_init_complete()) {
+        keyboard_boot_phase_mark(BOOT_PHASE_COMPLETE);
+    }
+}
+
+/** \brief keyboard_init
+ *
+ * Brings up everything needed to scan the matrix and report keypresses to the
+ * host, followed by the remaining subsystems -- either right away, or across
+ * the first scans with BOOT_DEFERRED_INIT.
+ */
+void keyboard_init(void) {
+    timer_init();
+    sync_timer_init();
+    keyboard_boot_phase_mark(BOOT_PHASE_INIT);
+    // Single read of the core configuration, every module below is served from RAM
+    eeconfig_load();
+#ifdef VIA_ENABLE
+    via_init();
+#endif
+#ifdef SPLIT_KEYBOARD
+    split_pre_init();
+#endif
+#ifdef ENCODER_ENABLE
+    encoder_init();
+#endif
+    matrix_init();
+    quantum_init();
+    led_init_ports();
+#ifdef BOOT_DEFERRED_INIT
+    for (uint8_t i = 0; i < ARRAY_SIZE(init_steps); ++i) {
+        if (!init_steps[i].deferred) {
+            init_steps[i].init();
+        }
+    }
+#else
+    while (!keyboard_init_complete()) {
+        init_step_next();
+    }
+#endif
+
+    keyboard_boot_phase_mark(BOOT_PHASE_CRITICAL);
 }
 
 /** \brief key_event_task
@@ -499,6 +600,9 @@ void keyboard_init(void) {
  * This is differnet than keycode events as no layer processing, or filtering occurs.
  */
 void switch_events(uint8_t row, uint8_t col, bool pressed) {
+    if (!keyboard_init_complete()) {
+        return;
+    }
 #if defined(LED_MATRIX_ENABLE)
     process_led_matrix(row, col, pressed);
 #endif
@@ -664,6 +768,13 @@ void keyboard_task(void) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
+    keyboard_boot_phase_mark(BOOT_PHASE_FIRST_SCAN);
+
+    // Deferred subsystems, and their tasks below, are only run once everything is up
+    __attribute__((unused)) const bool init_complete = keyboard_init_complete();
+    if (!init_complete) {
+        init_step_next();
+    }
 
     quantum_task();
 
@@ -671,20 +782,33 @@ void keyboard_task(void) {
     split_watchdog_task();
 #endif
 
+    eeconfig_task();
+
+#ifdef WEAR_LEVELING_ENABLE
+    // Failed steps are retried on the next call, report them so a failing backing store doesn't go unnoticed
+    if (wear_leveling_task() == WEAR_LEVELING_FAILED) {
+        dprintf("wear_leveling_task: backing store operation failed\n");
+    }
+#endif
+
+#ifdef EEPROM_WRITE_BACK_ENABLE
+    eeprom_write_back_task();
+#endif
+
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    if (init_complete) rgblight_task();
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    if (init_complete) led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    if (init_complete) rgb_matrix_task();
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
+    if (init_complete) backlight_task();
 #    endif
 #endif
 
@@ -696,25 +820,25 @@ void keyboard_task(void) {
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    if (init_complete && pointing_device_task()) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    if (init_complete) oled_task();
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
-    if (activity_has_occurred) oled_on();
+    if (init_complete && activity_has_occurred) oled_on();
 #    endif
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    if (init_complete) st7565_task();
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
-    if (activity_has_occurred) st7565_on();
+    if (init_complete && activity_has_occurred) st7565_on();
 #    endif
 #endif
 
@@ -724,7 +848,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    if (init_complete) ps2_mouse_task();
 #endif
 
 #ifdef MIDI_ENABLE
@@ -736,11 +860,11 @@ void keyboard_task(void) {
 #endif
 
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+    if (init_complete) bluetooth_task();
 #endif
 
 #ifdef HAPTIC_ENABLE
-    haptic_task();
+    if (init_complete) haptic_task();
 #endif
 
     led_task();
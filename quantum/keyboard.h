@@ -113,6 +113,23 @@ void keyboard_task(void);
 bool is_keyboard_master(void);
 /* it runs whenever code has to behave differently on left vs right split */
 bool is_keyboard_left(void);
+/* whether every subsystem has been initialized, see BOOT_DEFERRED_INIT */
+bool keyboard_init_complete(void);
+
+/* Milestones of keyboard startup, for measuring time to first report */
+typedef enum boot_phase_t {
+    BOOT_PHASE_INIT,         // keyboard_init() entered
+    BOOT_PHASE_CRITICAL,     // matrix, keymap and host ready
+    BOOT_PHASE_FIRST_SCAN,   // first matrix scan completed
+    BOOT_PHASE_FIRST_REPORT, // first keyboard report sent to the host
+    BOOT_PHASE_COMPLETE,     // all subsystems initialized, keyboard_post_init_kb() called
+    BOOT_PHASE_COUNT
+} boot_phase_t;
+
+#define BOOT_PHASE_PENDING UINT32_MAX
+
+void     keyboard_boot_phase_mark(boot_phase_t phase);
+uint32_t keyboard_boot_phase_time(boot_phase_t phase);
 
 void keyboard_pre_init_kb(void);
 void keyboard_pre_init_user(void);
@@ -64,6 +64,72 @@
 #    define QUANTUM_PAINTER_CONCURRENT_ANIMATIONS 4
 #endif // QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 
+#ifndef QUANTUM_PAINTER_ANIMATION_FRAMES_PER_TICK
+/**
+ * @def This controls the maximum number of animation frames that Quantum Painter will render in one execution of its
+ *      internal task. Any other animations that are due are rendered on the following executions, keeping the time
+ *      taken away from matrix scanning bounded. Set to 0 to render every animation that is due.
+ */
+#    define QUANTUM_PAINTER_ANIMATION_FRAMES_PER_TICK 0
+#endif // QUANTUM_PAINTER_ANIMATION_FRAMES_PER_TICK
+
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_INDEX
+/**
+ * @def This controls whether or not each font's unicode glyph table is copied to RAM when it is loaded, so that glyphs
+ *      can be found using a binary search rather than scanning the whole table. Requires 6 bytes of RAM per unicode
+ *      glyph in each loaded font.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_INDEX FALSE
+#endif // QUANTUM_PAINTER_FONT_GLYPH_INDEX
+
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of recently drawn glyphs whose width and data location are remembered by each font,
+ *      skipping the glyph table lookup when they are drawn again. Set to 0 to disable.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE 8
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_IMAGE_CACHE_SIZE
+/**
+ * @def This controls the size in bytes of the pool used to cache decoded image and animation frames in the display's
+ *      native pixel format, so that drawing them again skips decoding. Frames larger than the pool aren't cached, and
+ *      the least recently drawn frames are evicted to make room. Set to 0 to disable.
+ */
+#    define QUANTUM_PAINTER_IMAGE_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of decoded frames held in the image cache at any one time.
+ */
+#    define QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES 8
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES
+
+#ifndef QUANTUM_PAINTER_FLASH_STREAM_BLOCK_SIZE
+/**
+ * @def This controls the number of bytes read from external flash at a time when streaming images and fonts with
+ *      \ref qp_load_image_flash or \ref qp_load_font_flash. Larger blocks get closer to the SPI bus throughput, at the
+ *      cost of RAM.
+ */
+#    define QUANTUM_PAINTER_FLASH_STREAM_BLOCK_SIZE 256
+#endif // QUANTUM_PAINTER_FLASH_STREAM_BLOCK_SIZE
+
+#ifndef QUANTUM_PAINTER_FLASH_STREAM_BLOCKS
+/**
+ * @def This controls the number of blocks of external flash kept in RAM, shared between all images and fonts loaded
+ *      from flash.
+ */
+#    define QUANTUM_PAINTER_FLASH_STREAM_BLOCKS 2
+#endif // QUANTUM_PAINTER_FLASH_STREAM_BLOCKS
+
+#ifndef QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS
+/**
+ * @def This controls the address in external flash of the asset directory created by `qmk painter-pack-assets`.
+ */
+#    define QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS 0
+#endif // QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS
+
 #ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE
 /**
  * @def This controls the maximum size of the pixel data buffer used for single blocks of transmission. Larger buffers
@@ -72,6 +138,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_ASYNC_COMMS
+/**
+ * @def This controls whether or not the pixel data buffer is double-buffered, so that the next block of pixel data can
+ *      be prepared while the previous one is transmitted in the background by comms drivers that support it (SPI on
+ *      ChibiOS, using DMA where available). Doubles the RAM used by the pixel data buffer.
+ */
+#    define QUANTUM_PAINTER_ASYNC_COMMS FALSE
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -353,6 +428,20 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads an image from the asset directory in external flash.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param name[in] the name of the image in the asset directory
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(const char *name);
+#endif // FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -440,6 +529,19 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads a font from the asset directory in external flash.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param name[in] the name of the font in the asset directory
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(const char *name);
+#endif // FLASH_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
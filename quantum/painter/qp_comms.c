@@ -2,10 +2,14 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_comms.h"
+#include "qp_draw.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base comms APIs
 
+// The device between qp_comms_start() and qp_comms_stop(), if any
+static painter_device_t active_device = NULL;
+
 bool qp_comms_init(painter_device_t device) {
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -23,7 +27,12 @@ bool qp_comms_start(painter_device_t device) {
         return false;
     }
 
-    return driver->comms_vtable->comms_start(device);
+    if (!driver->comms_vtable->comms_start(device)) {
+        return false;
+    }
+
+    active_device = device;
+    return true;
 }
 
 void qp_comms_stop(painter_device_t device) {
@@ -34,6 +43,24 @@ void qp_comms_stop(painter_device_t device) {
     }
 
     driver->comms_vtable->comms_stop(device);
+    if (active_device == device) {
+        active_device = NULL;
+    }
+}
+
+painter_device_t qp_comms_suspend(void) {
+    painter_device_t device = active_device;
+    if (device) {
+        qp_comms_stop(device);
+    }
+    return device;
+}
+
+void qp_comms_resume(painter_device_t device) {
+    // Displays carry on with the transfer in progress once re-selected, as long as no new command is sent
+    if (device && !qp_comms_start(device)) {
+        qp_dprintf("qp_comms_resume: fail (could not restart comms)\n");
+    }
 }
 
 uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
@@ -43,6 +70,13 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    // Only the pixdata buffers are known not to be modified or released before the transfer completes
+    if (driver->comms_vtable->comms_send_async && qp_internal_pixdata_buffer_handoff(data)) {
+        return driver->comms_vtable->comms_send_async(device, data, byte_count);
+    }
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
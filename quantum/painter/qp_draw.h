@@ -10,7 +10,17 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_ASYNC_COMMS
+extern uint8_t *qp_internal_global_pixdata_buffer;
+#else  // QUANTUM_PAINTER_ASYNC_COMMS
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
+// Switches to the other pixdata buffer if double-buffered and the current one is still being transmitted. Needs to be invoked before new pixel data is written to the buffer.
+void qp_internal_pixdata_buffer_prepare(void);
+
+// Check if the supplied data lives within the pixdata buffer(s), and if so, mark it as being transmitted
+bool qp_internal_pixdata_buffer_handoff(const void* data);
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -21,6 +31,9 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device);
 // Fills the supplied buffer with equivalent native pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val);
 
+// fill_pixels implementation shared by the drivers with 16-bit native pixels, the target buffer needs to be 4-byte aligned
+bool qp_internal_fill_pixels_rgb565(painter_device_t device, uint8_t* target_buffer, qp_pixel_t* color, uint32_t pixel_count);
+
 // qp_setpixel internal implementation, but uses the global pixdata buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 
@@ -140,6 +140,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
             return false;
         }
         state->pixel_write_pos = 0;
+        qp_internal_pixdata_buffer_prepare();
     }
 
     return true;
@@ -160,6 +161,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
             return false;
         }
         state->byte_write_pos = 0;
+        qp_internal_pixdata_buffer_prepare();
     }
 
     return true;
@@ -171,6 +173,9 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
 
     bool ret = false;
 
+    // Previous glyphs or image frames may still be in transmission
+    qp_internal_pixdata_buffer_prepare();
+
     // Non-native pixel format
     if (bpp <= 8) {
         // Set up the output state
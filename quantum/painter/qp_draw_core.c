@@ -20,7 +20,14 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_ASYNC_COMMS
+// Double-buffered, so one half can be filled while the other is transmitted in the background
+__attribute__((__aligned__(4))) static uint8_t pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+static const uint8_t *                         pixdata_in_flight                 = NULL; // Buffer last handed off to a comms driver
+uint8_t *                                      qp_internal_global_pixdata_buffer = pixdata_buffers[0];
+#else  // QUANTUM_PAINTER_ASYNC_COMMS
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -36,6 +43,28 @@ __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
+void qp_internal_pixdata_buffer_prepare(void) {
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    // Comms drivers only keep one transfer in flight, so the other buffer is free once this one has been handed off
+    if (qp_internal_global_pixdata_buffer == pixdata_in_flight) {
+        qp_internal_global_pixdata_buffer = (qp_internal_global_pixdata_buffer == pixdata_buffers[0]) ? pixdata_buffers[1] : pixdata_buffers[0];
+    }
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+}
+
+bool qp_internal_pixdata_buffer_handoff(const void *data) {
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    const uint8_t *p = (const uint8_t *)data;
+    for (int i = 0; i < 2; ++i) {
+        if (p >= pixdata_buffers[i] && p < &pixdata_buffers[i][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE]) {
+            pixdata_in_flight = pixdata_buffers[i];
+            return true;
+        }
+    }
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+    return false;
+}
+
 uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     painter_driver_t *driver = (painter_driver_t *)device;
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
@@ -47,6 +76,19 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y)
     return driver->driver_vtable->viewport(device, x, y, x, y) && driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, 1);
 }
 
+// Fills the start of the target buffer with a single 16-bit pixel, two pixels per 32-bit store
+bool qp_internal_fill_pixels_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *color, uint32_t pixel_count) {
+    uint32_t  pattern = ((uint32_t)color->rgb565 << 16) | color->rgb565;
+    uint32_t *words   = (uint32_t *)target_buffer;
+    for (uint32_t i = 0; i < pixel_count / 2; ++i) {
+        words[i] = pattern;
+    }
+    if (pixel_count & 1) {
+        ((uint16_t *)target_buffer)[pixel_count - 1] = color->rgb565;
+    }
+    return true;
+}
+
 // Fills the global native pixel buffer with equivalent pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val) {
     painter_driver_t *driver            = (painter_driver_t *)device;
@@ -57,7 +99,15 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
     driver->driver_vtable->palette_convert(device, 1, &color);
 
-    // Append the required number of pixels
+    // Callers send the buffer repeatedly without modifying it, but whatever was there before may still be in transmission
+    qp_internal_pixdata_buffer_prepare();
+
+    // Let the driver fill the buffer in bulk if it can, otherwise append the required number of pixels
+    if (driver->driver_vtable->fill_pixels) {
+        driver->driver_vtable->fill_pixels(device, qp_internal_global_pixdata_buffer, &color, num_pixels);
+        return;
+    }
+
     uint8_t palette_idx = 0;
     for (uint32_t i = 0; i < num_pixels; ++i) {
         driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
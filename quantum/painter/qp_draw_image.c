@@ -19,11 +19,18 @@ typedef struct qgf_image_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // FLASH_ENABLE
     };
 } qgf_image_handle_t;
 
 static qgf_image_handle_t image_descriptors[QUANTUM_PAINTER_NUM_IMAGES] = {0};
 
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+static void image_cache_remove_image(qgf_image_handle_t *qgf_image);
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load image from stream
 
@@ -85,6 +92,21 @@ painter_image_handle_t qp_load_image_mem(const void *buffer) {
     return qp_load_image_internal(image_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef FLASH_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_flash
+
+static inline bool image_flash_stream_factory(qgf_image_handle_t *image, void *arg) {
+    return qp_make_flash_asset_stream(&image->flash_stream, (const char *)arg);
+}
+
+painter_image_handle_t qp_load_image_flash(const char *name) {
+    return qp_load_image_internal(image_flash_stream_factory, (void *)name);
+}
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_image
 
@@ -95,6 +117,11 @@ bool qp_close_image(painter_image_handle_t image) {
         return false;
     }
 
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    // Any cached frames would otherwise be matched against whichever image reuses this handle
+    image_cache_remove_image(qgf_image);
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
     // Free up this image for use elsewhere.
     qgf_image->validate_ok = false;
     qp_stream_close(&qgf_image->stream);
@@ -124,6 +151,129 @@ typedef struct qgf_frame_info_t {
     uint16_t              delay;
 } qgf_frame_info_t;
 
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decoded frame cache
+//
+// Frames are decoded straight into a fixed pool in the target device's native pixel format, so that redrawing them
+// is a single pixdata transfer. Entries are packed in pool order; evicting the least recently used one moves the
+// entries after it down, so the free space is always at the end of the pool.
+
+_Static_assert(QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES > 0 && QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES <= UINT8_MAX, "QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES must be between 1 and 255");
+
+typedef struct image_cache_entry_t {
+    const qgf_image_handle_t *image;
+    painter_device_t          device;
+    uint16_t                  frame_number;
+    qp_pixel_t                fg_hsv888;
+    qp_pixel_t                bg_hsv888;
+    qgf_frame_info_t          frame_info;
+    uint32_t                  offset;
+    uint32_t                  length;
+    uint32_t                  last_used;
+} image_cache_entry_t;
+
+__attribute__((__aligned__(4))) static uint8_t image_cache_pool[QUANTUM_PAINTER_IMAGE_CACHE_SIZE];
+static image_cache_entry_t                     image_cache_entries[QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES];
+static uint8_t                                 image_cache_count = 0;
+static uint32_t                                image_cache_used  = 0;
+static uint32_t                                image_cache_clock = 0;
+
+static image_cache_entry_t *image_cache_find(qgf_image_handle_t *qgf_image, painter_device_t device, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (uint8_t i = 0; i < image_cache_count; ++i) {
+        image_cache_entry_t *entry = &image_cache_entries[i];
+        if (entry->image == qgf_image && entry->device == device && entry->frame_number == frame_number && memcmp(&entry->fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&entry->bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
+            entry->last_used = ++image_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void image_cache_remove(uint8_t index) {
+    image_cache_entry_t *entry = &image_cache_entries[index];
+    uint32_t             end   = entry->offset + entry->length;
+    memmove(&image_cache_pool[entry->offset], &image_cache_pool[end], image_cache_used - end);
+    image_cache_used -= entry->length;
+    for (uint8_t i = index + 1; i < image_cache_count; ++i) {
+        image_cache_entries[i].offset -= entry->length;
+    }
+    memmove(&image_cache_entries[index], &image_cache_entries[index + 1], (image_cache_count - index - 1) * sizeof(image_cache_entry_t));
+    --image_cache_count;
+}
+
+static void image_cache_remove_image(qgf_image_handle_t *qgf_image) {
+    for (uint8_t i = image_cache_count; i > 0; --i) {
+        if (image_cache_entries[i - 1].image == qgf_image) {
+            image_cache_remove(i - 1);
+        }
+    }
+}
+
+static image_cache_entry_t *image_cache_allocate(uint32_t length) {
+    // Keep entries word-aligned, so that native pixels can be written directly
+    length = (length + 3) & ~3u;
+    if (length > QUANTUM_PAINTER_IMAGE_CACHE_SIZE) {
+        return NULL;
+    }
+
+    while (image_cache_count == QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES || image_cache_used + length > QUANTUM_PAINTER_IMAGE_CACHE_SIZE) {
+        uint8_t oldest = 0;
+        for (uint8_t i = 1; i < image_cache_count; ++i) {
+            if (image_cache_entries[i].last_used < image_cache_entries[oldest].last_used) {
+                oldest = i;
+            }
+        }
+        image_cache_remove(oldest);
+    }
+
+    image_cache_entry_t *entry = &image_cache_entries[image_cache_count++];
+    entry->offset              = image_cache_used;
+    entry->length              = length;
+    entry->last_used           = ++image_cache_clock;
+    image_cache_used += length;
+    return entry;
+}
+
+// Output state and callbacks for decoding directly into a cache entry
+typedef struct image_cache_output_state_t {
+    painter_device_t device;
+    uint8_t *        target;
+    uint32_t         write_pos;
+} image_cache_output_state_t;
+
+static bool image_cache_pixel_appender(qp_pixel_t *palette, uint8_t index, void *cb_arg) {
+    image_cache_output_state_t *state  = (image_cache_output_state_t *)cb_arg;
+    painter_driver_t *          driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixels(state->device, state->target, palette, state->write_pos++, 1, &index);
+}
+
+static bool image_cache_byte_appender(uint8_t byteval, void *cb_arg) {
+    image_cache_output_state_t *state  = (image_cache_output_state_t *)cb_arg;
+    painter_driver_t *          driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixdata(state->device, state->target, state->write_pos++, byteval);
+}
+
+// Equivalent of qp_internal_appender(), decoding into the cache entry instead of streaming to the display
+static bool image_cache_decode(painter_device_t device, image_cache_entry_t *entry, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void *input_state) {
+    painter_driver_t *         driver       = (painter_driver_t *)device;
+    image_cache_output_state_t output_state = {.device = device, .target = &image_cache_pool[entry->offset], .write_pos = 0};
+
+    if (bpp <= 8) {
+        return qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, image_cache_pixel_appender, &output_state);
+    }
+
+    if (bpp != driver->native_bits_per_pixel) {
+        qp_dprintf("Asset's bpp (%d) doesn't match the target display's native_bits_per_pixel (%d)\n", bpp, driver->native_bits_per_pixel);
+        return false;
+    }
+
+    return qp_internal_send_bytes(device, pixel_count * bpp / 8, input_callback, input_state, image_cache_byte_appender, &output_state);
+}
+
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
 static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info) {
     painter_driver_t *driver = (painter_driver_t *)device;
 
@@ -153,7 +303,6 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
 
     if (!qp_internal_bpp_capable(info->bpp)) {
         qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
-        qp_comms_stop(device);
         return false;
     }
 
@@ -178,7 +327,6 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         // Convert the palette to native format
         if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
             qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
-            qp_comms_stop(device);
             return false;
         }
     }
@@ -208,6 +356,7 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     return true;
 }
 
+// Draws the requested frame, with comms already started by the caller so that several frames can share a transaction
 static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
     qp_dprintf("qp_drawimage_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -222,17 +371,32 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    // Previously decoded frames can be sent as-is
+    image_cache_entry_t *cached = image_cache_find(qgf_image, device, frame_number, fg_hsv888, bg_hsv888);
+    if (cached) {
+        *frame_info = cached->frame_info;
+
+        // Nothing is decoded, but later draws still can't assume the palette was converted for this device
+        qp_internal_invalidate_palette();
+
+        uint16_t l = x + (frame_info->is_delta ? frame_info->left : 0);
+        uint16_t t = y + (frame_info->is_delta ? frame_info->top : 0);
+        uint16_t r = frame_info->is_delta ? (x + frame_info->right) : (x + image->width - 1);
+        uint16_t b = frame_info->is_delta ? (y + frame_info->bottom) : (y + image->height - 1);
+        bool     ret = driver->driver_vtable->viewport(device, l, t, r, b) && driver->driver_vtable->pixdata(device, &image_cache_pool[cached->offset], ((uint32_t)(r - l + 1)) * (b - t + 1));
+
+        qp_dprintf("qp_drawimage_recolor: %s (cached)\n", ret ? "ok" : "fail");
+        return ret;
+    }
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
     // Read the frame info
     if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
         return false;
     }
 
-    if (!qp_comms_start(device)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
-        return false;
-    }
-
     uint16_t l, t, r, b;
     if (frame_info->is_delta) {
         l = x + frame_info->left;
@@ -250,7 +414,6 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     // Configure where we're going to be rendering to
     if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
-        qp_comms_stop(device);
         return false;
     }
 
@@ -259,15 +422,34 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
     if (input_callback == NULL) {
         qp_dprintf("qp_drawimage_recolor: fail (invalid image compression scheme)\n");
-        qp_comms_stop(device);
         return false;
     }
 
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    // Decode into the cache if there's room, then send it from there
+    image_cache_entry_t *entry = image_cache_allocate((pixel_count * driver->native_bits_per_pixel + 7) / 8);
+    if (entry) {
+        entry->image        = qgf_image;
+        entry->device       = device;
+        entry->frame_number = frame_number;
+        entry->fg_hsv888    = fg_hsv888;
+        entry->bg_hsv888    = bg_hsv888;
+        entry->frame_info   = *frame_info;
+
+        bool ret = image_cache_decode(device, entry, frame_info->bpp, pixel_count, input_callback, &input_state) && driver->driver_vtable->pixdata(device, &image_cache_pool[entry->offset], pixel_count);
+        if (!ret) {
+            image_cache_remove(entry - image_cache_entries);
+        }
+
+        qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
+        return ret;
+    }
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
     // Decode and stream pixels
     bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
-    qp_comms_stop(device);
     return ret;
 }
 
@@ -275,7 +457,15 @@ bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, paint
     qgf_frame_info_t frame_info = {0};
     qp_pixel_t       fg_hsv888  = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t       bg_hsv888  = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
+        return false;
+    }
+
+    bool ret = qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
+    qp_comms_stop(device);
+    return ret;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -296,13 +486,14 @@ typedef struct animation_state_t {
     qp_pixel_t             fg_hsv888;
     qp_pixel_t             bg_hsv888;
     uint16_t               frame_number;
+    uint32_t               next_frame_time;
     deferred_token         defer_token;
 } animation_state_t;
 
-static deferred_executor_t animation_executors[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
-static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS]    = {0};
+static animation_state_t animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
+static deferred_token    animation_last_token                                    = INVALID_DEFERRED_TOKEN;
 
-static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
+static bool qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
     qgf_frame_info_t frame_info = {0};
     qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
     bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
@@ -317,16 +508,79 @@ static deferred_token qp_render_animation_state(animation_state_t *state, uint16
     return ret;
 }
 
-static uint32_t animation_callback(uint32_t trigger_time, void *cb_arg) {
-    animation_state_t *state = (animation_state_t *)cb_arg;
-    uint16_t           delay_ms;
-    bool               ret = qp_render_animation_state(state, &delay_ms);
-    if (!ret) {
-        // Setting the device to NULL clears the animation slot
-        state->device = NULL;
+// Reads the delay and the area drawn by a frame, without touching the palette or preparing to read its pixel data
+static bool qp_read_animation_frame_extent(animation_state_t *state, uint16_t frame_number, qgf_frame_info_t *info) {
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)state->image;
+    qgf_seek_to_frame_descriptor(&qgf_image->stream, frame_number);
+
+    qgf_frame_v1_t frame_descriptor;
+    if (qp_stream_read(&frame_descriptor, sizeof(qgf_frame_v1_t), 1, &qgf_image->stream) != 1 || !qgf_parse_frame_descriptor(&frame_descriptor, &info->bpp, &info->has_palette, &info->is_panel_native, &info->is_delta, &info->compression_scheme, &info->delay)) {
+        return false;
+    }
+
+    info->left   = 0;
+    info->top    = 0;
+    info->right  = state->image->width - 1;
+    info->bottom = state->image->height - 1;
+    if (info->is_delta) {
+        if (info->has_palette) {
+            qgf_palette_v1_t palette_descriptor;
+            if (qp_stream_read(&palette_descriptor, sizeof(qgf_palette_v1_t), 1, &qgf_image->stream) != 1) {
+                return false;
+            }
+            qp_stream_seek(&qgf_image->stream, palette_descriptor.header.length, SEEK_CUR);
+        }
+
+        qgf_delta_v1_t delta_descriptor;
+        if (qp_stream_read(&delta_descriptor, sizeof(qgf_delta_v1_t), 1, &qgf_image->stream) != 1) {
+            return false;
+        }
+        info->left   = delta_descriptor.left;
+        info->top    = delta_descriptor.top;
+        info->right  = delta_descriptor.right;
+        info->bottom = delta_descriptor.bottom;
+    }
+    return true;
+}
+
+// Works out which frame to draw for an animation that's due, skipping frames that would be overdrawn anyway
+static void qp_catch_up_animation_state(animation_state_t *state, uint32_t now) {
+    qgf_frame_info_t frame_info;
+    if (!qp_read_animation_frame_extent(state, state->frame_number, &frame_info)) {
+        return;
+    }
+
+    // Area touched by the frames skipped so far, and the one that'd be drawn now
+    uint16_t l = frame_info.left, t = frame_info.top, r = frame_info.right, b = frame_info.bottom;
+    uint32_t frame_time = state->next_frame_time;
+    for (uint16_t skipped = 1; skipped < state->image->frame_count; ++skipped) {
+        // Stop once the following frame isn't due yet
+        frame_time += frame_info.delay;
+        if (!timer_expired32(now, frame_time)) {
+            break;
+        }
+
+        // A delta frame only redraws part of the image, so frames can only be dropped if the following one covers
+        // everything they would have changed -- otherwise the display would be left with a mix of frames
+        uint16_t next_frame = (state->frame_number + 1) % state->image->frame_count;
+        if (!qp_read_animation_frame_extent(state, next_frame, &frame_info) || frame_info.left > l || frame_info.top > t || frame_info.right < r || frame_info.bottom < b) {
+            break;
+        }
+
+        qp_dprintf("qp_catch_up_animation_state: skipping frame #%d\n", (int)state->frame_number);
+        state->frame_number    = next_frame;
+        state->next_frame_time = frame_time;
+        l                      = frame_info.left;
+        t                      = frame_info.top;
+        r                      = frame_info.right;
+        b                      = frame_info.bottom;
     }
-    // If we're successful, keep animating -- returning 0 cancels the deferred execution
-    return ret ? delay_ms : 0;
+}
+
+static void qp_stop_animation_state(animation_state_t *state) {
+    // Setting the device to NULL clears the animation slot
+    state->device      = NULL;
+    state->defer_token = INVALID_DEFERRED_TOKEN;
 }
 
 deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
@@ -356,19 +610,30 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
 
     // Draw the first frame
     uint16_t delay_ms;
-    if (!qp_render_animation_state(anim_state, &delay_ms)) {
-        anim_state->device = NULL; // disregard the allocated animation slot
+    bool     ret = qp_comms_start(device);
+    if (ret) {
+        ret = qp_render_animation_state(anim_state, &delay_ms);
+        qp_comms_stop(device);
+    }
+    if (!ret) {
+        qp_stop_animation_state(anim_state); // disregard the allocated animation slot
         qp_dprintf("qp_animate_recolor: fail (could not render first frame)\n");
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Set up the timer
-    anim_state->defer_token = defer_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, delay_ms, animation_callback, anim_state);
-    if (anim_state->defer_token == INVALID_DEFERRED_TOKEN) {
-        anim_state->device = NULL; // disregard the allocated animation slot
-        qp_dprintf("qp_animate_recolor: fail (could not set up animation executor)\n");
-        return INVALID_DEFERRED_TOKEN;
-    }
+    // Schedule the next frame, handing out a token that isn't used by any other animation
+    anim_state->next_frame_time = timer_read32() + delay_ms;
+    bool in_use;
+    do {
+        if (++animation_last_token == INVALID_DEFERRED_TOKEN) {
+            ++animation_last_token;
+        }
+        in_use = false;
+        for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
+            in_use |= animation_states[i].device != NULL && animation_states[i].defer_token == animation_last_token;
+        }
+    } while (in_use);
+    anim_state->defer_token = animation_last_token;
 
     qp_dprintf("qp_animate_recolor: ok (deferred token = %d)\n", (int)anim_state->defer_token);
     return anim_state->defer_token;
@@ -379,9 +644,8 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
 
 void qp_stop_animation(deferred_token anim_token) {
     for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
-        if (animation_states[i].defer_token == anim_token) {
-            cancel_deferred_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, anim_token);
-            animation_states[i].device = NULL;
+        if (animation_states[i].device != NULL && animation_states[i].defer_token == anim_token) {
+            qp_stop_animation_state(&animation_states[i]);
             return;
         }
     }
@@ -391,6 +655,61 @@ void qp_stop_animation(deferred_token anim_token) {
 // Quantum Painter Core API: qp_internal_animation_tick
 
 void qp_internal_animation_tick(void) {
-    static uint32_t last_anim_exec = 0;
-    deferred_exec_advanced_task(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, &last_anim_exec);
+    // Work out which animations are due, most overdue first
+    uint32_t           now = timer_read32();
+    animation_state_t *due[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS];
+    uint8_t            due_count = 0;
+    for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
+        animation_state_t *state = &animation_states[i];
+        if (state->device == NULL || !timer_expired32(now, state->next_frame_time)) {
+            continue;
+        }
+
+        uint8_t pos = due_count++;
+        while (pos > 0 && TIMER_DIFF_32(now, due[pos - 1]->next_frame_time) < TIMER_DIFF_32(now, state->next_frame_time)) {
+            due[pos] = due[pos - 1];
+            --pos;
+        }
+        due[pos] = state;
+    }
+
+#if QUANTUM_PAINTER_ANIMATION_FRAMES_PER_TICK > 0
+    // Leave the rest for the next tick, rather than holding up the scan loop
+    due_count = QP_MIN(due_count, QUANTUM_PAINTER_ANIMATION_FRAMES_PER_TICK);
+#endif // QUANTUM_PAINTER_ANIMATION_FRAMES_PER_TICK > 0
+
+    // Render one frame of each, with every animation on the same device sharing a single transaction
+    for (uint8_t i = 0; i < due_count; ++i) {
+        if (due[i] == NULL) {
+            continue; // already rendered alongside an earlier animation on the same device
+        }
+
+        painter_device_t device   = due[i]->device;
+        bool             comms_ok = qp_comms_start(device);
+        for (uint8_t j = i; j < due_count; ++j) {
+            animation_state_t *state = due[j];
+            if (state == NULL || state->device != device) {
+                continue;
+            }
+            due[j] = NULL;
+
+            qp_catch_up_animation_state(state, now);
+
+            uint16_t delay_ms;
+            if (!comms_ok || !qp_render_animation_state(state, &delay_ms)) {
+                qp_stop_animation_state(state);
+                continue;
+            }
+
+            // Keep to the animation's own timeline, unless it's fallen a whole frame behind -- playing the backlog
+            // back-to-back would only make the scan loop fall further behind
+            state->next_frame_time += delay_ms;
+            if (timer_expired32(now, state->next_frame_time)) {
+                state->next_frame_time = now + delay_ms;
+            }
+        }
+        if (comms_ok) {
+            qp_comms_stop(device);
+        }
+    }
 }
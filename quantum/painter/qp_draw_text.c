@@ -12,6 +12,14 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point;
+    uint32_t glyph_offset;
+    uint8_t  width;
+} qff_glyph_cache_entry_t;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
@@ -21,21 +29,76 @@ typedef struct qff_font_handle_t {
     bool                  has_palette;
     bool                  is_panel_native;
     painter_compression_t compression_scheme;
+    uint32_t              glyph_data_offset; // Stream position of the first glyph's pixel data
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // FLASH_ENABLE
     };
 #if QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
     bool  owns_buffer;
     void *buffer;
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
+#if QUANTUM_PAINTER_FONT_GLYPH_INDEX
+    qff_unicode_glyph_v1_t *glyph_index; // Unicode glyph table sorted by code point, NULL if unavailable
+#endif // QUANTUM_PAINTER_FONT_GLYPH_INDEX
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    uint8_t                 glyph_cache_count;
+    qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE]; // Most recently used first
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
 } qff_font_handle_t;
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper: glyph lookup tables
+
+static inline uint32_t qff_unicode_glyph_table_offset(qff_font_handle_t *qff_font) {
+    return sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
+           + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+           + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
+}
+
+#if QUANTUM_PAINTER_FONT_GLYPH_INDEX
+// Copies the unicode glyph table to RAM so that lookups can binary search it instead of scanning the stream
+static void qff_build_glyph_index(qff_font_handle_t *qff_font) {
+    qff_font->glyph_index = NULL;
+    if (qff_font->num_unicode_glyphs == 0) {
+        return;
+    }
+
+    qff_unicode_glyph_v1_t *index = malloc(qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t));
+    if (index == NULL) {
+        qp_dprintf("qp_load_font: could not allocate enough RAM for glyph index, falling back to table scan\n");
+        return;
+    }
+
+    if (qp_stream_setpos(&qff_font->stream, qff_unicode_glyph_table_offset(qff_font)) < 0 || qp_stream_read(index, sizeof(qff_unicode_glyph_v1_t), qff_font->num_unicode_glyphs, &qff_font->stream) != qff_font->num_unicode_glyphs) {
+        qp_dprintf("qp_load_font: could not read unicode glyph table, falling back to table scan\n");
+        free(index);
+        return;
+    }
+
+    // The CLI writes the table in code point order already, in which case this is a single pass
+    for (uint16_t i = 1; i < qff_font->num_unicode_glyphs; ++i) {
+        qff_unicode_glyph_v1_t glyph = index[i];
+        uint16_t               j     = i;
+        while (j > 0 && index[j - 1].code_point > glyph.code_point) {
+            index[j] = index[j - 1];
+            --j;
+        }
+        index[j] = glyph;
+    }
+
+    qff_font->glyph_index = index;
+}
+#endif // QUANTUM_PAINTER_FONT_GLYPH_INDEX
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -73,13 +136,16 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
     font->owns_buffer = false;
     font->buffer      = NULL;
 
-    void *ram_buffer = malloc(font->mem_stream.length);
+    // Not necessarily a memory stream, so ask the font itself for the length
+    uint32_t length     = qff_get_total_size(&font->stream);
+    void *   ram_buffer = malloc(length);
     if (ram_buffer == NULL) {
         qp_dprintf("qp_load_font: could not allocate enough RAM for font, falling back to original\n");
     } else {
         do {
-            // Copy the data into RAM
-            if (qp_stream_read(ram_buffer, 1, font->mem_stream.length, &font->mem_stream) != font->mem_stream.length) {
+            // Copy the data into RAM, validation has left the stream past the lookup tables
+            qp_stream_setpos(&font->stream, 0);
+            if (qp_stream_read(ram_buffer, 1, length, &font->stream) != length) {
                 qp_dprintf("qp_load_font: could not copy from flash to RAM, falling back to original\n");
                 break;
             }
@@ -87,7 +153,7 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
             // Create the new stream with the new buffer
             font->buffer      = ram_buffer;
             font->owns_buffer = true;
-            font->mem_stream  = qp_make_memory_stream(font->buffer, font->mem_stream.length);
+            font->mem_stream  = qp_make_memory_stream(font->buffer, length);
         } while (0);
     }
 
@@ -106,6 +172,20 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+    // Glyph offsets are relative to the start of the data block, which follows all the lookup tables and the palette
+    font->glyph_data_offset = sizeof(qff_font_descriptor_v1_t)                                                                                                          // Skip the font descriptor
+                              + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                        // Skip the ascii table
+                              + (font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                              + (font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                              // Skip the palette
+                              + sizeof(qgf_block_header_v1_t);                                                                                                          // Skip the data block header
+
+#if QUANTUM_PAINTER_FONT_GLYPH_INDEX
+    qff_build_glyph_index(font);
+#endif // QUANTUM_PAINTER_FONT_GLYPH_INDEX
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    font->glyph_cache_count = 0;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -132,6 +212,21 @@ painter_font_handle_t qp_load_font_mem(const void *buffer) {
     return qp_load_font_internal(font_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef FLASH_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_font_flash
+
+static inline bool font_flash_stream_factory(qff_font_handle_t *font, void *arg) {
+    return qp_make_flash_asset_stream(&font->flash_stream, (const char *)arg);
+}
+
+painter_font_handle_t qp_load_font_flash(const char *name) {
+    return qp_load_font_internal(font_flash_stream_factory, (void *)name);
+}
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_font
 
@@ -151,6 +246,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_FONT_GLYPH_INDEX
+    free(qff_font->glyph_index);
+    qff_font->glyph_index = NULL;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_INDEX
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -214,7 +314,9 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
-static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+// Looks up the width and data offset of a glyph in the font's tables
+static bool qff_find_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *glyph_offset) {
+    uint32_t glyph_value = 0;
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -231,65 +333,106 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
+        glyph_value = glyph_info.value;
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
-
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
+        bool found = false;
+#if QUANTUM_PAINTER_FONT_GLYPH_INDEX
+        if (qff_font->glyph_index) {
+            // Binary search the in-RAM copy of the table
+            uint16_t lo = 0;
+            uint16_t hi = qff_font->num_unicode_glyphs;
+            while (lo < hi) {
+                uint16_t mid = lo + (hi - lo) / 2;
+                if (qff_font->glyph_index[mid].code_point < code_point) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
 
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+            if (lo < qff_font->num_unicode_glyphs && qff_font->glyph_index[lo].code_point == code_point) {
+                glyph_value = qff_font->glyph_index[lo].value;
+                found       = true;
+            }
+        } else
+#endif // QUANTUM_PAINTER_FONT_GLYPH_INDEX
+        {
+            if (qp_stream_setpos(&qff_font->stream, qff_unicode_glyph_table_offset(qff_font)) < 0) {
+                qp_dprintf("Failed to set stream position while preparing glyph data\n");
                 return false;
             }
 
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
+            qff_unicode_glyph_v1_t glyph_info;
+            for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+                if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+                    qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
                     return false;
                 }
 
-                *width = glyph_width;
-                return true;
+                if (glyph_info.code_point == code_point) {
+                    glyph_value = glyph_info.value;
+                    found       = true;
+                    break;
+                }
             }
         }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
+        if (!found) {
+            qp_dprintf("Failed to find unicode glyph info\n");
+            return false;
+        }
+    }
+
+    *width        = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+    *glyph_offset = ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    return true;
+}
+
+static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+    uint8_t  glyph_width;
+    uint32_t glyph_offset;
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    // Recently used glyphs skip the table lookup entirely; hits are moved to the front, misses evict the last entry
+    qff_glyph_cache_entry_t *cache = qff_font->glyph_cache;
+    uint8_t                  slot  = 0;
+    while (slot < qff_font->glyph_cache_count && cache[slot].code_point != code_point) {
+        ++slot;
+    }
+
+    qff_glyph_cache_entry_t entry;
+    if (slot < qff_font->glyph_cache_count) {
+        entry = cache[slot];
+    } else {
+        entry.code_point = code_point;
+        if (!qff_find_glyph(qff_font, code_point, &entry.width, &entry.glyph_offset)) {
+            return false;
+        }
+        if (qff_font->glyph_cache_count < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE) {
+            slot = qff_font->glyph_cache_count++;
+        } else {
+            slot = QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE - 1;
+        }
+    }
+
+    memmove(&cache[1], &cache[0], slot * sizeof(qff_glyph_cache_entry_t));
+    cache[0]     = entry;
+    glyph_width  = entry.width;
+    glyph_offset = entry.glyph_offset;
+#else  // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    if (!qff_find_glyph(qff_font, code_point, &glyph_width, &glyph_offset)) {
         return false;
     }
-    return false;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
+    if (qp_stream_setpos(&qff_font->stream, qff_font->glyph_data_offset + glyph_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    *width = glyph_width;
+    return true;
 }
 
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
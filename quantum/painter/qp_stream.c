@@ -164,3 +164,184 @@ qp_file_stream_t qp_make_file_stream(FILE *f) {
     return stream;
 }
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Flash streams
+
+#ifdef FLASH_ENABLE
+
+#    include "flash_spi.h"
+#    include "qp_comms.h"
+
+_Static_assert(QUANTUM_PAINTER_FLASH_STREAM_BLOCKS > 0, "QUANTUM_PAINTER_FLASH_STREAM_BLOCKS must be at least 1");
+
+// Blocks of flash shared by all flash streams. Reading a whole block per SPI transaction keeps the per-transaction
+// overhead (command, address and busy polling) small compared to the data transferred, and keeping a few of them
+// around covers the usual access pattern of a lookup table or palette interleaved with sequential pixel data.
+typedef struct flash_stream_block_t {
+    uint32_t address;
+    uint32_t last_used;
+    bool     valid;
+    uint8_t  data[QUANTUM_PAINTER_FLASH_STREAM_BLOCK_SIZE];
+} flash_stream_block_t;
+
+static flash_stream_block_t  flash_stream_blocks[QUANTUM_PAINTER_FLASH_STREAM_BLOCKS];
+static flash_stream_block_t *flash_stream_last_block = NULL;
+static uint32_t              flash_stream_clock      = 0;
+
+void qp_flash_stream_invalidate(void) {
+    for (int i = 0; i < QUANTUM_PAINTER_FLASH_STREAM_BLOCKS; ++i) {
+        flash_stream_blocks[i].valid = false;
+    }
+    flash_stream_last_block = NULL;
+}
+
+static flash_stream_block_t *flash_stream_get_block(uint32_t address) {
+    uint32_t block_address = address - (address % QUANTUM_PAINTER_FLASH_STREAM_BLOCK_SIZE);
+
+    // Most reads are sequential within the same block
+    if (flash_stream_last_block && flash_stream_last_block->address == block_address) {
+        return flash_stream_last_block;
+    }
+
+    flash_stream_block_t *block = &flash_stream_blocks[0];
+    for (int i = 0; i < QUANTUM_PAINTER_FLASH_STREAM_BLOCKS; ++i) {
+        if (flash_stream_blocks[i].valid && flash_stream_blocks[i].address == block_address) {
+            block            = &flash_stream_blocks[i];
+            block->last_used = ++flash_stream_clock;
+            return flash_stream_last_block = block;
+        }
+        if (!flash_stream_blocks[i].valid || (block->valid && flash_stream_blocks[i].last_used < block->last_used)) {
+            block = &flash_stream_blocks[i];
+        }
+    }
+
+    uint32_t length = QUANTUM_PAINTER_FLASH_STREAM_BLOCK_SIZE;
+    if (block_address + length > EXTERNAL_FLASH_SIZE) {
+        length = EXTERNAL_FLASH_SIZE - block_address;
+    }
+
+    // Streams are read while drawing, so any display holding the SPI bus needs to let go of it for the duration
+    painter_device_t suspended = qp_comms_suspend();
+    flash_status_t   status    = flash_read_block(block_address, block->data, length);
+    qp_comms_resume(suspended);
+
+    if (status != FLASH_STATUS_SUCCESS) {
+        qp_dprintf("qp_flash_stream: fail (could not read 0x%08lX)\n", (unsigned long)block_address);
+        block->valid            = false;
+        flash_stream_last_block = NULL;
+        return NULL;
+    }
+
+    block->address   = block_address;
+    block->last_used = ++flash_stream_clock;
+    block->valid     = true;
+    return flash_stream_last_block = block;
+}
+
+static inline int16_t flash_get(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    uint32_t              address = s->address + s->position;
+    flash_stream_block_t *block   = flash_stream_get_block(address);
+    if (!block) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    s->position++;
+    return block->data[address - block->address];
+}
+
+static inline bool flash_put(qp_stream_t *stream, uint8_t c) {
+    // Read-only, writing to flash requires erasing whole sectors
+    return false;
+}
+
+static inline int flash_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    // Same bounds as memory streams
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_close(qp_stream_t *stream) {
+    // No-op.
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    qp_flash_stream_t stream = {
+        .base     = {.get = flash_get, .put = flash_put, .seek = flash_seek, .tell = flash_tell, .is_eof = flash_is_eof, .close = flash_close},
+        .address  = address,
+        .length   = length,
+        .position = 0,
+    };
+    return stream;
+}
+
+bool qp_make_flash_asset_stream(qp_flash_stream_t *stream, const char *name) {
+    // Read through a stream over the directory itself, so that lookups are served from the block cache
+    qp_flash_stream_t              directory = qp_make_flash_stream(QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS, EXTERNAL_FLASH_SIZE - QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS);
+    qp_flash_directory_header_v1_t header;
+    if (qp_stream_read(&header, sizeof(header), 1, &directory) != 1 || memcmp(header.magic, QP_FLASH_DIRECTORY_MAGIC, sizeof(header.magic)) != 0 || header.version != QP_FLASH_DIRECTORY_VERSION) {
+        qp_dprintf("qp_flash_stream: fail (no asset directory at 0x%08lX)\n", (unsigned long)QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS);
+        return false;
+    }
+
+    for (uint16_t i = 0; i < header.num_entries; ++i) {
+        qp_flash_directory_entry_v1_t entry;
+        if (qp_stream_read(&entry, sizeof(entry), 1, &directory) != 1) {
+            break;
+        }
+        if (strncmp(entry.name, name, sizeof(entry.name)) == 0) {
+            // Checked separately so that a corrupt entry can't wrap around past the end of flash
+            if (entry.offset > (uint32_t)directory.length || entry.length > (uint32_t)directory.length - entry.offset) {
+                qp_dprintf("qp_flash_stream: fail (asset '%s' out of bounds)\n", name);
+                return false;
+            }
+            *stream = qp_make_flash_stream(QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS + entry.offset, entry.length);
+            return true;
+        }
+    }
+
+    qp_dprintf("qp_flash_stream: fail (asset '%s' not found)\n", name);
+    return false;
+}
+
+#endif // FLASH_ENABLE
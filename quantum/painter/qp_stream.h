@@ -83,3 +83,47 @@ typedef struct qp_file_stream_t {
 qp_file_stream_t qp_make_file_stream(FILE *f);
 
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Flash streams
+
+#ifdef FLASH_ENABLE
+
+typedef struct qp_flash_stream_t {
+    qp_stream_t base;
+    uint32_t    address;
+    int32_t     length;
+    int32_t     position;
+    bool        is_eof;
+} qp_flash_stream_t;
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length);
+
+// Looks up the named asset in the flash asset directory, creating a stream over it if found
+bool qp_make_flash_asset_stream(qp_flash_stream_t *stream, const char *name);
+
+// Discards any cached flash contents, required after the flash has been rewritten
+void qp_flash_stream_invalidate(void);
+
+// Flash asset directory, found at QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS
+#    define QP_FLASH_DIRECTORY_MAGIC "QPAD"
+#    define QP_FLASH_DIRECTORY_VERSION 1
+#    define QP_FLASH_DIRECTORY_NAME_LENGTH 24
+
+typedef struct QP_PACKED qp_flash_directory_header_v1_t {
+    uint8_t  magic[4];    // QP_FLASH_DIRECTORY_MAGIC
+    uint16_t version;     // QP_FLASH_DIRECTORY_VERSION
+    uint16_t num_entries; // Number of qp_flash_directory_entry_v1_t directly following the header
+} qp_flash_directory_header_v1_t;
+
+_Static_assert(sizeof(qp_flash_directory_header_v1_t) == 8, "qp_flash_directory_header_v1_t must be 8 bytes in v1 of the asset directory");
+
+typedef struct QP_PACKED qp_flash_directory_entry_v1_t {
+    uint32_t offset;                               // Start of the asset, relative to the directory header
+    uint32_t length;                               // Size of the asset in bytes
+    char     name[QP_FLASH_DIRECTORY_NAME_LENGTH]; // Asset name, NUL-padded
+} qp_flash_directory_entry_v1_t;
+
+_Static_assert(sizeof(qp_flash_directory_entry_v1_t) == 32, "qp_flash_directory_entry_v1_t must be 32 bytes in v1 of the asset directory");
+
+#endif // FLASH_ENABLE
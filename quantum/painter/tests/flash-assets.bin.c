@@ -0,0 +1,219 @@
+// Copyright 2024 QMK -- generated source code only, assets retain original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was generated from the output of `qmk painter-pack-assets -o flash-assets.bin ghoul-logo.qgf thintel15.qff`,
+// using the raw images from ghoul-logo.qgf.c and thintel15.qff.c
+
+#include <qp.h>
+
+const uint32_t flash_assets_length = 3270;
+
+// clang-format off
+const uint8_t flash_assets[3270] = {
+    0x51, 0x50, 0x41, 0x44, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x07, 0x00, 0x00,
+    0x67, 0x68, 0x6F, 0x75, 0x6C, 0x2D, 0x6C, 0x6F, 0x67, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0xC6, 0x03, 0x00, 0x00,
+    0x74, 0x68, 0x69, 0x6E, 0x74, 0x65, 0x6C, 0x31, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x90, 0x07, 0x00, 0x00, 0x6F, 0xF8, 0xFF,
+    0xFF, 0x46, 0x00, 0x80, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x60, 0x07, 0x00,
+    0x08, 0x00, 0x81, 0xF9, 0x6F, 0x0E, 0x00, 0x83, 0x40, 0xFE, 0xFF, 0xBF, 0x0D, 0x00, 0x80, 0x80,
+    0x03, 0xFF, 0x80, 0x7F, 0x0C, 0x00, 0x80, 0x40, 0x04, 0xFF, 0x80, 0x2F, 0x0B, 0x00, 0x81, 0x40,
+    0xFE, 0x04, 0xFF, 0x80, 0x1F, 0x0B, 0x00, 0x80, 0xFD, 0x05, 0xFF, 0x80, 0x0B, 0x03, 0x00, 0x80,
+    0x01, 0x02, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0xF8, 0x06, 0xFF, 0x80, 0x03, 0x02, 0x00, 0x80,
+    0x20, 0x03, 0x00, 0x80, 0x0E, 0x02, 0x00, 0x80, 0xE0, 0x07, 0xFF, 0x03, 0x00, 0x80, 0x02, 0x02,
+    0x00, 0x83, 0xF4, 0x01, 0x00, 0x80, 0x07, 0xFF, 0x80, 0x3F, 0x02, 0x00, 0x80, 0xA0, 0x02, 0x00,
+    0x81, 0xC0, 0x1F, 0x02, 0x00, 0x80, 0xFE, 0x07, 0xFF, 0x80, 0x0F, 0x02, 0x00, 0x80, 0x0A, 0x02,
+    0x00, 0x83, 0xFD, 0x01, 0x00, 0xF4, 0x08, 0xFF, 0x88, 0x02, 0x00, 0xA4, 0x01, 0x00, 0xE0, 0x0F,
+    0x00, 0xD0, 0x08, 0xFF, 0x83, 0xBF, 0x00, 0x40, 0x2A, 0x02, 0x00, 0x80, 0xFF, 0x02, 0x00, 0x09,
+    0xFF, 0x88, 0x1F, 0x00, 0xA4, 0x06, 0x00, 0xF4, 0x0F, 0x00, 0xF8, 0x09, 0xFF, 0x87, 0x02, 0x40,
+    0xAA, 0x00, 0x80, 0xBF, 0x00, 0xD0, 0x09, 0xFF, 0x88, 0x7F, 0x00, 0xA4, 0x0A, 0x00, 0xFC, 0x0B,
+    0x00, 0xFE, 0x09, 0xFF, 0x87, 0x0B, 0x40, 0xAA, 0x01, 0xC0, 0xBF, 0x00, 0xF4, 0x09, 0xFF, 0x87,
+    0xBF, 0x01, 0xA4, 0x2A, 0x00, 0xFD, 0x0B, 0x80, 0x0A, 0xFF, 0x87, 0x2B, 0x40, 0xAA, 0x02, 0xD0,
+    0xBF, 0x00, 0xFD, 0x09, 0xFF, 0x87, 0xBF, 0x06, 0xA4, 0x6A, 0x00, 0xFE, 0x0B, 0xE0, 0x0A, 0xFF,
+    0x86, 0xAB, 0x40, 0xAA, 0x0A, 0xE0, 0xFF, 0x00, 0x0A, 0xFF, 0x87, 0xBF, 0x0A, 0xA4, 0xAA, 0x00,
+    0xFE, 0x0F, 0xF4, 0x0A, 0xFF, 0x86, 0xAA, 0x02, 0xAA, 0x0A, 0xE0, 0xFF, 0x80, 0x0A, 0xFF, 0x87,
+    0xAF, 0x2A, 0xA0, 0xAA, 0x00, 0xFE, 0x1F, 0xFC, 0x0A, 0xFF, 0x86, 0xAA, 0x06, 0xA9, 0x0A, 0xE0,
+    0xFF, 0xD1, 0x0A, 0xFF, 0x87, 0xAF, 0x6A, 0x90, 0xAA, 0x00, 0xFE, 0x2F, 0xFE, 0x0A, 0xFF, 0x86,
+    0xAA, 0x0A, 0xA9, 0x0A, 0xF0, 0xFF, 0xF3, 0x0A, 0xFF, 0x86, 0xAF, 0xAA, 0xA0, 0x6A, 0x00, 0xFF,
+    0x7F, 0x0B, 0xFF, 0x86, 0xAA, 0x1A, 0xAA, 0x02, 0xF0, 0xFF, 0xFB, 0x0A, 0xFF, 0x84, 0xAF, 0xAA,
+    0xA6, 0x1A, 0x00, 0x03, 0xFF, 0x80, 0xF7, 0x09, 0xFF, 0x80, 0xA9, 0x02, 0xAA, 0x81, 0x00, 0xF0,
+    0x02, 0xFF, 0x80, 0x1F, 0x09, 0xFF, 0x80, 0x0F, 0x02, 0xAA, 0x81, 0x1A, 0x40, 0x02, 0xFF, 0x81,
+    0xBF, 0xF0, 0x09, 0xFF, 0x80, 0x90, 0x02, 0xAA, 0x81, 0x06, 0xF4, 0x02, 0xFF, 0x81, 0x07, 0xFE,
+    0x08, 0xFF, 0x81, 0x0F, 0xA8, 0x02, 0xAA, 0x80, 0x41, 0x02, 0xFF, 0x81, 0x7F, 0xE0, 0x09, 0xFF,
+    0x80, 0x80, 0x02, 0xAA, 0x81, 0x2A, 0xF8, 0x02, 0xFF, 0x81, 0x03, 0xFD, 0x08, 0xFF, 0x81, 0x0B,
+    0xA8, 0x02, 0xAA, 0x80, 0x86, 0x02, 0xFF, 0x81, 0x3F, 0xD0, 0x08, 0xFF, 0x81, 0x7F, 0x80, 0x02,
+    0xAA, 0x81, 0x6A, 0xFC, 0x02, 0xFF, 0x81, 0x07, 0xFC, 0x08, 0xFF, 0x81, 0x03, 0xA8, 0x02, 0xAA,
+    0x80, 0xCA, 0x02, 0xFF, 0x83, 0xBF, 0x80, 0xFF, 0xD7, 0x04, 0xFF, 0x83, 0xBF, 0xFD, 0x3F, 0x80,
+    0x03, 0xAA, 0x80, 0xFD, 0x02, 0xFF, 0x83, 0x0F, 0xF4, 0x0F, 0xF8, 0x04, 0xFF, 0x83, 0x02, 0xFE,
+    0x02, 0xA9, 0x02, 0xAA, 0x80, 0xEA, 0x03, 0xFF, 0x82, 0x01, 0x2E, 0x00, 0x04, 0xFF, 0x83, 0x1F,
+    0x80, 0x0F, 0xA0, 0x03, 0xAA, 0x03, 0xFF, 0x80, 0x3F, 0x02, 0x00, 0x80, 0xE0, 0x04, 0xFF, 0x02,
+    0x00, 0x80, 0x80, 0x03, 0xAA, 0x80, 0xEA, 0x03, 0xFF, 0x80, 0x0F, 0x02, 0x00, 0x80, 0xFD, 0x03,
+    0xFF, 0x80, 0x0B, 0x02, 0x00, 0x80, 0xA9, 0x02, 0xAA, 0x81, 0x6A, 0xFD, 0x03, 0xFF, 0x82, 0x07,
+    0x00, 0x80, 0x03, 0xFF, 0x80, 0x3F, 0x02, 0x00, 0x80, 0xA9, 0x03, 0xAA, 0x80, 0xC2, 0x03, 0xFF,
+    0x80, 0xBF, 0x02, 0x00, 0x80, 0xF4, 0x03, 0xFF, 0x82, 0x02, 0x00, 0xA0, 0x03, 0xAA, 0x81, 0x2A,
+    0xFC, 0x03, 0xFF, 0x80, 0x07, 0x02, 0x00, 0x80, 0xFE, 0x02, 0xFF, 0x80, 0x0F, 0x02, 0x00, 0x80,
+    0xA9, 0x03, 0xAA, 0x80, 0xC2, 0x03, 0xFF, 0x80, 0x2F, 0x02, 0x00, 0x80, 0xC0, 0x02, 0xFF, 0x80,
+    0x7F, 0x03, 0x00, 0x03, 0xAA, 0x81, 0x1A, 0xF8, 0x02, 0xFF, 0x80, 0xBF, 0x03, 0x00, 0x80, 0xF4,
+    0x02, 0xFF, 0x80, 0x02, 0x02, 0x00, 0x80, 0x90, 0x03, 0xAA, 0x80, 0x81, 0x03, 0xFF, 0x80, 0x07,
+    0x03, 0x00, 0x82, 0xFD, 0xFF, 0x07, 0x03, 0x00, 0x80, 0xA8, 0x02, 0xAA, 0x81, 0x1A, 0xF8, 0x02,
+    0xFF, 0x80, 0x2F, 0x03, 0x00, 0x83, 0x94, 0xFF, 0x6F, 0x01, 0x02, 0x00, 0x80, 0x40, 0x03, 0xAA,
+    0x80, 0x82, 0x03, 0xFF, 0x80, 0x01, 0x02, 0x00, 0x80, 0x80, 0x02, 0xFF, 0x80, 0x7F, 0x03, 0x00,
+    0x80, 0xA0, 0x02, 0xAA, 0x81, 0x2A, 0xF8, 0x02, 0xFF, 0x80, 0x0F, 0x03, 0x00, 0x80, 0xFC, 0x02,
+    0xFF, 0x80, 0x03, 0x03, 0x00, 0x80, 0xA9, 0x02, 0xAA, 0x80, 0x82, 0x02, 0xFF, 0x80, 0x7F, 0x03,
+    0x00, 0x80, 0xC0, 0x02, 0xFF, 0x80, 0x7F, 0x03, 0x00, 0x80, 0x80, 0x02, 0xAA, 0x81, 0x6A, 0xF8,
+    0x02, 0xFF, 0x80, 0x07, 0x03, 0x00, 0x80, 0xFC, 0x02, 0xFF, 0x80, 0x07, 0x03, 0x00, 0x80, 0xA8,
+    0x02, 0xAA, 0x80, 0xC6, 0x02, 0xFF, 0x80, 0x3F, 0x03, 0x00, 0x80, 0xD0, 0x02, 0xFF, 0x80, 0x7F,
+    0x03, 0x00, 0x80, 0x40, 0x02, 0xAA, 0x81, 0x6A, 0xFC, 0x02, 0xFF, 0x80, 0x02, 0x03, 0x00, 0x80,
+    0xFD, 0x02, 0xFF, 0x80, 0x0B, 0x03, 0x00, 0x80, 0xA4, 0x02, 0xAA, 0x80, 0xC6, 0x02, 0xFF, 0x80,
+    0x2F, 0x03, 0x00, 0x83, 0xE0, 0xBF, 0xD0, 0xBF, 0x04, 0x00, 0x02, 0xAA, 0x81, 0x6A, 0xFC, 0x02,
+    0xFF, 0x80, 0x01, 0x03, 0x00, 0x83, 0xFE, 0x03, 0xF8, 0x0F, 0x03, 0x00, 0x80, 0xA0, 0x02, 0xAA,
+    0x80, 0xC6, 0x02, 0xFF, 0x80, 0x1F, 0x03, 0x00, 0x83, 0xF0, 0x1F, 0x00, 0xFF, 0x04, 0x00, 0x02,
+    0xAA, 0x81, 0x6A, 0xFC, 0x02, 0xFF, 0x80, 0x01, 0x02, 0x00, 0x84, 0x40, 0xBF, 0x00, 0xE0, 0x1F,
+    0x03, 0x00, 0x80, 0xA0, 0x02, 0xAA, 0x80, 0xC6, 0x02, 0xFF, 0x80, 0x1F, 0x03, 0x00, 0x84, 0xF4,
+    0x07, 0x00, 0xFC, 0x02, 0x03, 0x00, 0x02, 0xAA, 0x81, 0x2A, 0xFC, 0x02, 0xFF, 0x80, 0x02, 0x02,
+    0x00, 0x84, 0x80, 0x3F, 0x00, 0x80, 0x3F, 0x03, 0x00, 0x80, 0xA0, 0x02, 0xAA, 0x80, 0x82, 0x02,
+    0xFF, 0x80, 0x2F, 0x03, 0x00, 0x84, 0xFD, 0x02, 0x00, 0xF8, 0x0B, 0x02, 0x00, 0x80, 0x40, 0x02,
+    0xAA, 0x81, 0x2A, 0xF8, 0x02, 0xFF, 0x80, 0x03, 0x02, 0x00, 0x84, 0xF0, 0x1F, 0x00, 0x40, 0xFF,
+    0x03, 0x00, 0x80, 0xA8, 0x02, 0xAA, 0x80, 0x41, 0x02, 0xFF, 0x80, 0x7F, 0x02, 0x00, 0x85, 0x80,
+    0xFF, 0x01, 0x00, 0xF0, 0x2F, 0x02, 0x00, 0x80, 0x80, 0x02, 0xAA, 0x81, 0x1A, 0xF0, 0x02, 0xFF,
+    0x80, 0x0F, 0x02, 0x00, 0x81, 0xFE, 0x0F, 0x02, 0x00, 0x81, 0xFF, 0x0B, 0x02, 0x00, 0x80, 0xA9,
+    0x02, 0xAA, 0x81, 0x00, 0xFE, 0x02, 0xFF, 0x83, 0x02, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0x84, 0xE0,
+    0xFF, 0x07, 0x00, 0xA0, 0x02, 0xAA, 0x81, 0x0A, 0xD0, 0x02, 0xFF, 0x84, 0xBF, 0x00, 0xF4, 0xFF,
+    0x0F, 0x02, 0x00, 0x83, 0xFE, 0xFF, 0x02, 0x90, 0x02, 0xAA, 0x82, 0x6A, 0x00, 0xBC, 0x02, 0xFF,
+    0x81, 0xBF, 0xFA, 0x02, 0xFF, 0x02, 0x00, 0x83, 0xE0, 0xFF, 0xBF, 0x96, 0x03, 0xAA, 0x82, 0x02,
+    0x40, 0xF3, 0x05, 0xFF, 0x80, 0x0B, 0x02, 0x00, 0x82, 0xFE, 0xFF, 0xAB, 0x03, 0xAA, 0x80, 0x1A,
+    0x02, 0x00, 0x05, 0xFF, 0x80, 0xBF, 0x02, 0x00, 0x82, 0xE0, 0xFF, 0xBF, 0x03, 0xAA, 0x80, 0x9A,
+    0x02, 0x00, 0x80, 0xE0, 0x05, 0xFF, 0x80, 0x0B, 0x02, 0x00, 0x82, 0xFE, 0xFF, 0xAB, 0x03, 0xAA,
+    0x80, 0x01, 0x02, 0x00, 0x80, 0xFD, 0x04, 0xFF, 0x80, 0xBF, 0x02, 0x00, 0x82, 0xD0, 0xFF, 0xAF,
+    0x03, 0xAA, 0x80, 0x0A, 0x02, 0x00, 0x80, 0xC0, 0x05, 0xFF, 0x80, 0x0B, 0x02, 0x00, 0x81, 0xFD,
+    0xFF, 0x04, 0xAA, 0x03, 0x00, 0x80, 0xF8, 0x04, 0xFF, 0x80, 0xBF, 0x02, 0x00, 0x82, 0xD0, 0xFF,
+    0xAF, 0x03, 0xAA, 0x80, 0x06, 0x02, 0x00, 0x80, 0x40, 0x05, 0xFF, 0x80, 0x0B, 0x02, 0x00, 0x81,
+    0xFD, 0xFF, 0x03, 0xAA, 0x80, 0x2A, 0x03, 0x00, 0x80, 0xE0, 0x04, 0xFF, 0x80, 0xBF, 0x02, 0x00,
+    0x82, 0xD0, 0xFF, 0xAF, 0x03, 0xAA, 0x80, 0x01, 0x03, 0x00, 0x80, 0xFD, 0x04, 0xFF, 0x84, 0x1B,
+    0x00, 0x40, 0xFE, 0xBF, 0x03, 0xAA, 0x80, 0x0A, 0x03, 0x00, 0x80, 0xD0, 0x05, 0xFF, 0x84, 0x0F,
+    0x00, 0xFE, 0xFF, 0xAB, 0x02, 0xAA, 0x80, 0x6A, 0x04, 0x00, 0x80, 0xFD, 0x05, 0xFF, 0x83, 0x90,
+    0xE0, 0xFF, 0xBF, 0x03, 0xAA, 0x80, 0x02, 0x03, 0x00, 0x80, 0xE0, 0x05, 0xFF, 0x84, 0x4F, 0x2F,
+    0xFE, 0xFF, 0xAB, 0x02, 0xAA, 0x80, 0x6A, 0x04, 0x00, 0x06, 0xFF, 0x83, 0xFD, 0xFB, 0xFF, 0xBF,
+    0x03, 0xAA, 0x80, 0x0A, 0x03, 0x00, 0x80, 0xF4, 0x09, 0xFF, 0x04, 0xAA, 0x03, 0x00, 0x80, 0x80,
+    0x09, 0xFF, 0x80, 0xAF, 0x03, 0xAA, 0x80, 0x1A, 0x03, 0x00, 0x80, 0xF8, 0x09, 0xFF, 0x04, 0xAA,
+    0x80, 0x02, 0x02, 0x00, 0x80, 0xC0, 0x02, 0xFF, 0x80, 0xEB, 0x06, 0xFF, 0x80, 0xAF, 0x03, 0xAA,
+    0x80, 0x2A, 0x03, 0x00, 0x83, 0xFC, 0xFF, 0x2F, 0xFE, 0x05, 0xFF, 0x80, 0xBF, 0x04, 0xAA, 0x80,
+    0x02, 0x02, 0x00, 0x83, 0xD0, 0xFF, 0xBF, 0xF0, 0x06, 0xFF, 0x80, 0xAB, 0x03, 0xAA, 0x80, 0x2A,
+    0x03, 0x00, 0x82, 0xFD, 0xFF, 0x07, 0x06, 0xFF, 0x85, 0xBF, 0xAA, 0x6A, 0xA9, 0xAA, 0x06, 0x02,
+    0x00, 0x8E, 0xD0, 0xFF, 0x7F, 0xF0, 0xFF, 0xFE, 0xBF, 0xFF, 0xEF, 0xFF, 0x9B, 0xAA, 0x81, 0xAA,
+    0x6A, 0x03, 0x00, 0x8E, 0xFD, 0xFF, 0x07, 0xFF, 0xDF, 0xFF, 0xF7, 0xFF, 0xFD, 0x2F, 0xAA, 0x0A,
+    0xA8, 0xAA, 0x06, 0x02, 0x00, 0x8E, 0xD0, 0xFF, 0x7F, 0xE0, 0xFF, 0xFD, 0x7F, 0xFE, 0xCF, 0xFF,
+    0xA2, 0xAA, 0x80, 0xAA, 0x6A, 0x03, 0x00, 0x8E, 0xFD, 0xFF, 0x07, 0xFD, 0x9F, 0xFF, 0xE7, 0xFF,
+    0xFC, 0x2F, 0xAA, 0x0A, 0xA8, 0xAA, 0x06, 0x02, 0x00, 0x8E, 0xD0, 0xFF, 0x7F, 0xD0, 0xFF, 0xF9,
+    0x3F, 0xFE, 0xCF, 0xFF, 0xA2, 0x6A, 0x80, 0xAA, 0x6A, 0x03, 0x00, 0x8E, 0xFC, 0xFF, 0x07, 0xFC,
+    0x9F, 0xFF, 0xE3, 0xFF, 0xFC, 0x1B, 0xAA, 0x02, 0xA8, 0xAA, 0x02, 0x02, 0x00, 0x8E, 0xC0, 0xFF,
+    0x3F, 0x80, 0xFF, 0xF5, 0x3F, 0xFF, 0xCF, 0xBF, 0xA1, 0x2A, 0x80, 0xAA, 0x2A, 0x03, 0x00, 0x8E,
+    0xF8, 0xBF, 0x00, 0xF4, 0x5F, 0xFF, 0xF3, 0xFF, 0xF9, 0x1B, 0xAA, 0x01, 0x90, 0xAA, 0x02, 0x02,
+    0x00, 0x81, 0x40, 0x6F, 0x02, 0x00, 0x8A, 0xFF, 0xF5, 0x3F, 0xFF, 0x9F, 0xAF, 0xA1, 0x0A, 0x00,
+    0xA0, 0x2A, 0x03, 0x00, 0x80, 0x70, 0x02, 0x00, 0x87, 0xF0, 0x5F, 0xFF, 0xF3, 0xFF, 0xF9, 0x1A,
+    0xAA, 0x02, 0x00, 0x81, 0x90, 0x01, 0x06, 0x00, 0x87, 0xFE, 0xF1, 0x2F, 0xFF, 0x5F, 0xAF, 0xA1,
+    0x0A, 0x09, 0x00, 0x87, 0xD0, 0x1F, 0xFF, 0xF2, 0xFF, 0xF5, 0x0A, 0x6A, 0x0A, 0x00, 0x87, 0xFC,
+    0xF2, 0x1F, 0xFF, 0x5F, 0xAB, 0xA0, 0x02, 0x09, 0x00, 0x87, 0xC0, 0x1F, 0xFF, 0xF0, 0xFF, 0xB0,
+    0x0A, 0x2A, 0x0A, 0x00, 0x87, 0xF8, 0xE1, 0x0F, 0xFE, 0x0F, 0xAA, 0xA0, 0x02, 0x09, 0x00, 0x87,
+    0x80, 0x0F, 0x7D, 0xD0, 0x7F, 0x90, 0x06, 0x1A, 0x0A, 0x00, 0x87, 0xB4, 0x80, 0x03, 0xF8, 0x03,
+    0x28, 0x90, 0x01, 0x0A, 0x00, 0x83, 0x02, 0x00, 0x40, 0x1F, 0x02, 0x00, 0x80, 0x08, 0x09, 0x00,
+    0x81, 0x02, 0x0E, 0x02, 0x00, 0x80, 0x50, 0x02, 0x00, 0x82, 0x40, 0x0A, 0x04, 0x07, 0x00, 0x83,
+    0x70, 0xF0, 0x02, 0xA0, 0x02, 0x00, 0x83, 0x40, 0x00, 0xA4, 0x80, 0x07, 0x00, 0x8A, 0x40, 0x0B,
+    0x7F, 0x00, 0x1F, 0xE0, 0x00, 0x0A, 0x80, 0x0A, 0x18, 0x07, 0x00, 0x8A, 0xF8, 0xF0, 0x0F, 0xF4,
+    0x02, 0x1F, 0xA4, 0x01, 0xA9, 0x90, 0x01, 0x06, 0x00, 0x8A, 0x80, 0x1F, 0xFF, 0x82, 0x7F, 0xF4,
+    0x82, 0x1A, 0xA0, 0x0A, 0x2A, 0x07, 0x00, 0x8A, 0xF8, 0xF2, 0x3F, 0xFC, 0xDF, 0xBF, 0xAA, 0x82,
+    0xAA, 0xA4, 0x02, 0x06, 0x00, 0x83, 0x80, 0x7F, 0xFE, 0xDB, 0x02, 0xFF, 0x84, 0xAB, 0x6A, 0xA9,
+    0x8A, 0x2A, 0x07, 0x00, 0x81, 0xF8, 0xEF, 0x03, 0xFF, 0x80, 0xBF, 0x02, 0xAA, 0x82, 0x6A, 0xAA,
+    0x02, 0x06, 0x00, 0x80, 0x80, 0x05, 0xFF, 0x80, 0xAB, 0x03, 0xAA, 0x80, 0x2A, 0x07, 0x00, 0x80,
+    0xF4, 0x04, 0xFF, 0x80, 0xAF, 0x04, 0xAA, 0x80, 0x01, 0x06, 0x00, 0x80, 0x40, 0x05, 0xFF, 0x04,
+    0xAA, 0x80, 0x1A, 0x07, 0x00, 0x80, 0xF0, 0x04, 0xFF, 0x80, 0xAF, 0x04, 0xAA, 0x08, 0x00, 0x80,
+    0xFE, 0x03, 0xFF, 0x80, 0xBF, 0x04, 0xAA, 0x80, 0x0A, 0x07, 0x00, 0x80, 0xE0, 0x04, 0xFF, 0x80,
+    0xAB, 0x03, 0xAA, 0x80, 0x6A, 0x08, 0x00, 0x80, 0xFD, 0x03, 0xFF, 0x80, 0xBF, 0x04, 0xAA, 0x80,
+    0x02, 0x07, 0x00, 0x80, 0xC0, 0x04, 0xFF, 0x04, 0xAA, 0x80, 0x2A, 0x08, 0x00, 0x80, 0xF4, 0x03,
+    0xFF, 0x80, 0xAF, 0x04, 0xAA, 0x80, 0x01, 0x08, 0x00, 0x03, 0xFF, 0x80, 0xBF, 0x04, 0xAA, 0x80,
+    0x0A, 0x08, 0x00, 0x84, 0xE0, 0x6F, 0xFE, 0xFF, 0xAB, 0x02, 0xAA, 0x81, 0x5A, 0x6A, 0x09, 0x00,
+    0x83, 0xFD, 0x40, 0xFF, 0xBF, 0x02, 0xAA, 0x82, 0x0A, 0x90, 0x02, 0x08, 0x00, 0x83, 0x80, 0x07,
+    0x40, 0xFE, 0x02, 0xAA, 0x82, 0x1A, 0x00, 0x28, 0x0C, 0x00, 0x82, 0xA9, 0xAA, 0x05, 0x07, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0x14, 0x00, 0x00, 0x51, 0x46, 0x46, 0x01, 0xC6, 0x03, 0x00, 0x00, 0x39, 0xFC, 0xFF,
+    0xFF, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x1D, 0x01, 0x00, 0x02, 0x00,
+    0x00, 0xC2, 0x00, 0x00, 0x84, 0x01, 0x00, 0x06, 0x03, 0x00, 0x46, 0x05, 0x00, 0x88, 0x07, 0x00,
+    0x46, 0x0A, 0x00, 0x82, 0x0C, 0x00, 0x43, 0x0D, 0x00, 0x83, 0x0E, 0x00, 0xC4, 0x0F, 0x00, 0x46,
+    0x11, 0x00, 0x83, 0x13, 0x00, 0xC5, 0x14, 0x00, 0x82, 0x16, 0x00, 0x44, 0x17, 0x00, 0xC5, 0x18,
+    0x00, 0x84, 0x1A, 0x00, 0x05, 0x1C, 0x00, 0xC5, 0x1D, 0x00, 0x85, 0x1F, 0x00, 0x45, 0x21, 0x00,
+    0x05, 0x23, 0x00, 0xC5, 0x24, 0x00, 0x85, 0x26, 0x00, 0x45, 0x28, 0x00, 0x02, 0x2A, 0x00, 0xC3,
+    0x2A, 0x00, 0x05, 0x2C, 0x00, 0xC5, 0x2D, 0x00, 0x85, 0x2F, 0x00, 0x45, 0x31, 0x00, 0x08, 0x33,
+    0x00, 0xC5, 0x35, 0x00, 0x85, 0x37, 0x00, 0x45, 0x39, 0x00, 0x05, 0x3B, 0x00, 0xC4, 0x3C, 0x00,
+    0x44, 0x3E, 0x00, 0xC5, 0x3F, 0x00, 0x85, 0x41, 0x00, 0x44, 0x43, 0x00, 0xC5, 0x44, 0x00, 0x85,
+    0x46, 0x00, 0x44, 0x48, 0x00, 0xC6, 0x49, 0x00, 0x06, 0x4C, 0x00, 0x45, 0x4E, 0x00, 0x05, 0x50,
+    0x00, 0xC5, 0x51, 0x00, 0x85, 0x53, 0x00, 0x45, 0x55, 0x00, 0x06, 0x57, 0x00, 0x45, 0x59, 0x00,
+    0x06, 0x5B, 0x00, 0x46, 0x5D, 0x00, 0x86, 0x5F, 0x00, 0xC6, 0x61, 0x00, 0x06, 0x64, 0x00, 0x44,
+    0x66, 0x00, 0xC4, 0x67, 0x00, 0x44, 0x69, 0x00, 0xC6, 0x6A, 0x00, 0x05, 0x6D, 0x00, 0xC3, 0x6E,
+    0x00, 0x05, 0x70, 0x00, 0xC5, 0x71, 0x00, 0x84, 0x73, 0x00, 0x05, 0x75, 0x00, 0xC5, 0x76, 0x00,
+    0x84, 0x78, 0x00, 0x05, 0x7A, 0x00, 0xC5, 0x7B, 0x00, 0x82, 0x7D, 0x00, 0x43, 0x7E, 0x00, 0x85,
+    0x7F, 0x00, 0x42, 0x81, 0x00, 0x06, 0x82, 0x00, 0x45, 0x84, 0x00, 0x05, 0x86, 0x00, 0xC5, 0x87,
+    0x00, 0x85, 0x89, 0x00, 0x44, 0x8B, 0x00, 0xC5, 0x8C, 0x00, 0x83, 0x8E, 0x00, 0xC5, 0x8F, 0x00,
+    0x86, 0x91, 0x00, 0xC6, 0x93, 0x00, 0x06, 0x96, 0x00, 0x45, 0x98, 0x00, 0x04, 0x9A, 0x00, 0x85,
+    0x9B, 0x00, 0x42, 0x9D, 0x00, 0x05, 0x9E, 0x00, 0xC5, 0x9F, 0x00, 0x04, 0xFB, 0x86, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x54, 0x45, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFD, 0xD2,
+    0xAF, 0x28, 0x00, 0x00, 0x00, 0x84, 0x53, 0x15, 0x0E, 0x55, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x15, 0x0A, 0x28, 0x54, 0x24, 0x00, 0x00, 0x00, 0x80, 0x50, 0x14, 0x52, 0x95, 0x58, 0x00,
+    0x00, 0x00, 0x14, 0x00, 0x00, 0x4A, 0x92, 0x24, 0x02, 0x00, 0x91, 0x24, 0x49, 0x01, 0x00, 0x20,
+    0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x1F, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x0A, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x24, 0x22,
+    0x11, 0x00, 0x00, 0xC0, 0xA4, 0x94, 0x52, 0x32, 0x00, 0x00, 0x20, 0x23, 0x22, 0x72, 0x00, 0x00,
+    0xC0, 0x24, 0x44, 0x44, 0x78, 0x00, 0x00, 0xC0, 0x24, 0x44, 0x50, 0x32, 0x00, 0x00, 0x80, 0x29,
+    0x95, 0x1E, 0x42, 0x00, 0x00, 0xE0, 0x85, 0x83, 0x50, 0x32, 0x00, 0x00, 0xC0, 0xA4, 0x70, 0x52,
+    0x32, 0x00, 0x00, 0xE0, 0x21, 0x42, 0x84, 0x10, 0x00, 0x00, 0xC0, 0xA4, 0x64, 0x52, 0x32, 0x00,
+    0x00, 0xC0, 0xA4, 0xE4, 0x50, 0x32, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x30, 0x60, 0x0A, 0x00,
+    0x00, 0x11, 0x11, 0x04, 0x41, 0x00, 0x00, 0x00, 0x80, 0x07, 0x1E, 0x00, 0x00, 0x00, 0x20, 0x08,
+    0x82, 0x88, 0x08, 0x00, 0x00, 0xC0, 0x24, 0x64, 0x04, 0x10, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x59,
+    0x55, 0x2D, 0x02, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0xA4, 0xF4, 0x52, 0x4A, 0x00, 0x00, 0xE0, 0xA4,
+    0x74, 0x52, 0x3A, 0x00, 0x00, 0xC0, 0xA4, 0x10, 0x42, 0x32, 0x00, 0x00, 0xE0, 0xA4, 0x94, 0x52,
+    0x3A, 0x00, 0x00, 0x70, 0x11, 0x17, 0x71, 0x00, 0x00, 0x70, 0x11, 0x17, 0x11, 0x00, 0x00, 0xC0,
+    0xA4, 0xD0, 0x52, 0x32, 0x00, 0x00, 0x20, 0xA5, 0xF4, 0x52, 0x4A, 0x00, 0x00, 0x70, 0x22, 0x22,
+    0x72, 0x00, 0x00, 0xC0, 0x21, 0x84, 0x50, 0x32, 0x00, 0x00, 0x20, 0xA5, 0x32, 0x4A, 0x4A, 0x00,
+    0x00, 0x10, 0x11, 0x11, 0x71, 0x00, 0x00, 0x40, 0xB4, 0x55, 0x51, 0x14, 0x45, 0x00, 0x00, 0x00,
+    0x40, 0x34, 0x55, 0x59, 0x14, 0x45, 0x00, 0x00, 0x00, 0xC0, 0xA4, 0x94, 0x52, 0x32, 0x00, 0x00,
+    0xE0, 0xA4, 0x74, 0x42, 0x08, 0x00, 0x00, 0xC0, 0xA4, 0x94, 0x52, 0x51, 0x00, 0x00, 0xE0, 0xA4,
+    0x74, 0x52, 0x4A, 0x00, 0x00, 0xC0, 0xA4, 0x60, 0x50, 0x32, 0x00, 0x00, 0xC0, 0x47, 0x10, 0x04,
+    0x41, 0x10, 0x00, 0x00, 0x00, 0x20, 0xA5, 0x94, 0x52, 0x32, 0x00, 0x00, 0x40, 0x14, 0x45, 0x51,
+    0xA4, 0x10, 0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0x51, 0xB5, 0x45, 0x00, 0x00, 0x00, 0x40, 0x14,
+    0x29, 0x84, 0x12, 0x45, 0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0x0E, 0x41, 0x10, 0x00, 0x00, 0x00,
+    0xC0, 0x07, 0x21, 0x84, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x17, 0x11, 0x11, 0x11, 0x07, 0x00, 0x10,
+    0x21, 0x22, 0x44, 0x00, 0x00, 0x47, 0x44, 0x44, 0x44, 0x07, 0x00, 0x84, 0x12, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x93, 0x5C, 0x72, 0x00, 0x00, 0x20, 0x84, 0x93, 0x52, 0x3A, 0x00, 0x00, 0x00, 0x60,
+    0x11, 0x61, 0x00, 0x00, 0x00, 0x21, 0x97, 0x52, 0x72, 0x00, 0x00, 0x00, 0x00, 0x93, 0x5E, 0x70,
+    0x00, 0x00, 0x60, 0x11, 0x13, 0x11, 0x00, 0x00, 0x00, 0x00, 0x97, 0x52, 0x72, 0x28, 0x19, 0x20,
+    0x84, 0x93, 0x52, 0x4A, 0x00, 0x00, 0x10, 0x55, 0x00, 0x80, 0x20, 0x49, 0x0A, 0x00, 0x20, 0x84,
+    0x94, 0x4E, 0x4A, 0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x00, 0x2C, 0x55, 0x55, 0x55, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x93, 0x52, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x93, 0x52, 0x32, 0x00, 0x00, 0x00,
+    0x80, 0x93, 0x52, 0x3A, 0x21, 0x00, 0x00, 0x00, 0x97, 0x52, 0x72, 0x08, 0x01, 0x00, 0x50, 0x13,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0C, 0x3A, 0x00, 0x00, 0x48, 0x96, 0x44, 0x00, 0x00, 0x00,
+    0x80, 0x94, 0x52, 0x72, 0x00, 0x00, 0x00, 0x00, 0x44, 0x51, 0xA4, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x44, 0x51, 0x54, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0A, 0xA1, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x94, 0x52, 0x72, 0x28, 0x19, 0x00, 0x70, 0x24, 0x71, 0x00, 0x00, 0x4C, 0x08,
+    0x11, 0x84, 0x10, 0x0C, 0x00, 0x55, 0x55, 0x01, 0x83, 0x10, 0x82, 0x08, 0x21, 0x03, 0x00, 0x00,
+    0x00, 0xB0, 0x1A, 0x00, 0x00, 0x00,
+};
+// clang-format on
@@ -0,0 +1,235 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <vector>
+
+#include "painter_test_common.hpp"
+
+extern "C" {
+#include "qgf.h"
+
+void qp_internal_animation_tick(void);
+void set_time(uint32_t t);
+}
+
+#define ANIM_SIZE 32
+#define ANIM_DELAY 10
+
+#define BLACK 0x0000
+#define WHITE 0xFFFF
+
+// Rectangles drawn by each frame of the test animation, see build_animation()
+#define RECT_A 0, 0, 7, 7
+#define RECT_B 0, 0, 15, 15
+#define RECT_C 24, 24, 31, 31
+
+class PainterAnimation : public PainterTest {
+   protected:
+    static std::vector<uint8_t>   animation_data;
+    static painter_image_handle_t animation;
+
+    std::vector<deferred_token> tokens;
+
+    static void put(std::vector<uint8_t>& v, uint32_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            v.push_back((value >> (8 * i)) & 0xFF);
+        }
+    }
+
+    static void put_block_header(std::vector<uint8_t>& v, uint8_t type_id, uint32_t length) {
+        put(v, type_id, 1);
+        put(v, (~type_id) & 0xFF, 1);
+        put(v, length, 3);
+    }
+
+    // Appends a 4bpp grayscale frame, filled with a single value
+    static void put_frame(std::vector<uint8_t>& v, uint8_t value, bool delta, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+        put_block_header(v, QGF_FRAME_DESCRIPTOR_TYPEID, sizeof(qgf_frame_v1_t) - sizeof(qgf_block_header_v1_t));
+        put(v, GRAYSCALE_4BPP, 1);
+        put(v, delta ? QGF_FRAME_FLAG_DELTA : 0, 1);
+        put(v, IMAGE_UNCOMPRESSED, 1);
+        put(v, 0, 1);
+        put(v, ANIM_DELAY, 2);
+        if (delta) {
+            put_block_header(v, QGF_FRAME_DELTA_DESCRIPTOR_TYPEID, sizeof(qgf_delta_v1_t) - sizeof(qgf_block_header_v1_t));
+            put(v, l, 2);
+            put(v, t, 2);
+            put(v, r, 2);
+            put(v, b, 2);
+        }
+        uint32_t length = ((r - l + 1) * (b - t + 1) + 1) / 2;
+        put_block_header(v, QGF_FRAME_DATA_DESCRIPTOR_TYPEID, length);
+        v.insert(v.end(), length, value | (value << 4));
+    }
+
+    /*
+        Four frames, each shown for ANIM_DELAY ms:
+        0: black, in full
+        1: delta, white over RECT_A
+        2: delta, gray over RECT_B, which covers RECT_A
+        3: delta, white over RECT_C, which doesn't overlap RECT_B
+    */
+    static std::vector<uint8_t> build_animation(void) {
+        std::vector<uint8_t> frames[4];
+        put_frame(frames[0], 0, false, 0, 0, ANIM_SIZE - 1, ANIM_SIZE - 1);
+        put_frame(frames[1], 15, true, RECT_A);
+        put_frame(frames[2], 5, true, RECT_B);
+        put_frame(frames[3], 15, true, RECT_C);
+
+        uint32_t offset = sizeof(qgf_graphics_descriptor_v1_t) + sizeof(qgf_frame_offsets_v1_t) + 4 * sizeof(uint32_t);
+        uint32_t total  = offset;
+        for (auto& f : frames) {
+            total += f.size();
+        }
+
+        std::vector<uint8_t> v;
+        put_block_header(v, QGF_GRAPHICS_DESCRIPTOR_TYPEID, sizeof(qgf_graphics_descriptor_v1_t) - sizeof(qgf_block_header_v1_t));
+        put(v, QGF_MAGIC, 3);
+        put(v, 0x01, 1);
+        put(v, total, 4);
+        put(v, ~total, 4);
+        put(v, ANIM_SIZE, 2);
+        put(v, ANIM_SIZE, 2);
+        put(v, 4, 2);
+        put_block_header(v, QGF_FRAME_OFFSET_DESCRIPTOR_TYPEID, 4 * sizeof(uint32_t));
+        for (auto& f : frames) {
+            put(v, offset, 4);
+            offset += f.size();
+        }
+        for (auto& f : frames) {
+            v.insert(v.end(), f.begin(), f.end());
+        }
+        return v;
+    }
+
+    void SetUp() override {
+        PainterTest::SetUp();
+        if (!animation) {
+            animation_data = build_animation();
+            animation      = qp_load_image_mem(animation_data.data());
+        }
+        ASSERT_NE(animation, nullptr) << "Could not load animation";
+        set_time(0);
+    }
+
+    void TearDown() override {
+        for (auto token : tokens) {
+            qp_stop_animation(token);
+        }
+    }
+
+    void animate(uint16_t x, uint16_t y) {
+        deferred_token token = qp_animate(panel, x, y, animation);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN) << "Could not start animation";
+        tokens.push_back(token);
+    }
+
+    // Runs the scheduler at the given time, returning the number of pixels sent to the panel
+    static uint32_t tick_at(uint32_t t) {
+        auto* stats = qp_virtual_panel_stats(panel);
+        *stats      = {};
+        set_time(t);
+        qp_internal_animation_tick();
+        return stats->pixels;
+    }
+
+    static uint16_t pixel(uint16_t x, uint16_t y) {
+        return panel_framebuffer[y * TEST_PANEL_WIDTH + x];
+    }
+
+    // Checks the panel shows the given frame of the animation drawn at the origin
+    static void expect_frame(int frame) {
+        uint16_t gray = pixel(0, 0);
+        if (frame == 2 || frame == 3) {
+            EXPECT_NE(gray, BLACK) << "RECT_B should be gray in frame " << frame;
+            EXPECT_NE(gray, WHITE) << "RECT_B should be gray in frame " << frame;
+        }
+        for (uint16_t y = 0; y < ANIM_SIZE; ++y) {
+            for (uint16_t x = 0; x < ANIM_SIZE; ++x) {
+                uint16_t expected = BLACK;
+                if (frame == 1 && x <= 7 && y <= 7) {
+                    expected = WHITE;
+                } else if ((frame == 2 || frame == 3) && x <= 15 && y <= 15) {
+                    expected = gray;
+                } else if (frame == 3 && x >= 24 && y >= 24) {
+                    expected = WHITE;
+                }
+                ASSERT_EQ(pixel(x, y), expected) << "Mismatch at (" << x << "," << y << ") for frame " << frame;
+            }
+        }
+    }
+};
+
+std::vector<uint8_t>   PainterAnimation::animation_data;
+painter_image_handle_t PainterAnimation::animation = nullptr;
+
+/**
+ * This test verifies that each frame is drawn when it's due, and only redraws its own delta region.
+ */
+TEST_F(PainterAnimation, PlaysOnTime) {
+    animate(0, 0);
+    expect_frame(0);
+
+    EXPECT_EQ(tick_at(5), 0) << "No frame should be due yet";
+    EXPECT_EQ(tick_at(10), 8 * 8) << "Frame 1 should only redraw RECT_A";
+    expect_frame(1);
+    EXPECT_EQ(tick_at(20), 16 * 16) << "Frame 2 should only redraw RECT_B";
+    expect_frame(2);
+    EXPECT_EQ(tick_at(30), 8 * 8) << "Frame 3 should only redraw RECT_C";
+    expect_frame(3);
+    EXPECT_EQ(tick_at(40), ANIM_SIZE * ANIM_SIZE) << "Frame 0 should redraw the whole image";
+    expect_frame(0);
+}
+
+/**
+ * This test verifies that a late animation drops frames that the following frame draws over entirely.
+ */
+TEST_F(PainterAnimation, SkipsCoveredFrames) {
+    animate(0, 0);
+
+    EXPECT_EQ(tick_at(25), 16 * 16) << "Frame 1 should have been skipped in favour of frame 2";
+    expect_frame(2);
+
+    EXPECT_EQ(tick_at(45), ANIM_SIZE * ANIM_SIZE) << "Frame 3 should have been skipped in favour of frame 0";
+    expect_frame(0);
+    EXPECT_EQ(tick_at(50), 8 * 8) << "Frame 1 should still be drawn on time";
+    expect_frame(1);
+}
+
+/**
+ * This test verifies that a late animation still draws frames that the following frame doesn't fully redraw, and
+ * resumes from the current time rather than playing the backlog back-to-back.
+ */
+TEST_F(PainterAnimation, KeepsUncoveredFrames) {
+    animate(0, 0);
+    EXPECT_EQ(tick_at(10), 8 * 8);
+
+    EXPECT_EQ(tick_at(35), 16 * 16) << "Frame 2 can't be skipped, as frame 3 doesn't cover it";
+    expect_frame(2);
+    EXPECT_EQ(tick_at(36), 0) << "Frame 3 should be rescheduled rather than drawn straight away";
+    EXPECT_EQ(tick_at(45), 8 * 8) << "Frame 3 should be drawn a frame's delay later";
+    expect_frame(3);
+}
+
+/**
+ * This test verifies that animations due at the same time on the same device share one transaction.
+ */
+TEST_F(PainterAnimation, BatchesPerDevice) {
+    animate(0, 0);
+    animate(64, 0);
+    animate(0, 64);
+
+    auto* stats = qp_virtual_panel_stats(panel);
+    EXPECT_EQ(tick_at(10), 3 * 8 * 8) << "All animations should have drawn frame 1";
+    EXPECT_EQ(stats->transactions, 1) << "All animations should have been drawn in a single transaction";
+    EXPECT_EQ(pixel(64, 0), WHITE) << "Second animation was not drawn";
+    EXPECT_EQ(pixel(0, 64), WHITE) << "Third animation was not drawn";
+}
+
+/**
+ * This test verifies that stopped animations are no longer drawn.
+ */
+TEST_F(PainterAnimation, Stops) {
+    animate(0, 0);
+    qp_stop_animation(tokens.back());
+    EXPECT_EQ(tick_at(10), 0) << "Stopped animation should not be drawn";
+}
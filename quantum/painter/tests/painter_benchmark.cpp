@@ -0,0 +1,127 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <chrono>
+#include <functional>
+
+#include "painter_test_common.hpp"
+
+/*
+    Times common Quantum Painter operations against the virtual panel, and
+    records what each one costs on the wire. The transfer counts are exact and
+    reproducible, so they are the numbers to compare between revisions; the
+    host timings only give an indication of CPU cost:
+
+        make test:painter_benchmark
+        .build/test/painter_benchmark.elf --gtest_output=json:painter.json
+
+    QP_BENCHMARK_ITERATIONS sets how many times each operation is repeated
+    (default 200).
+*/
+
+#define BENCHMARK_DEFAULT_ITERATIONS 200
+
+class PainterBenchmark : public PainterTest {
+   protected:
+    static uint32_t iterations(void) {
+        const char* value = getenv("QP_BENCHMARK_ITERATIONS");
+        return (value && *value) ? strtoul(value, nullptr, 10) : BENCHMARK_DEFAULT_ITERATIONS;
+    }
+
+    // Runs the operation repeatedly, recording the average time and panel traffic per call
+    qp_virtual_panel_stats_t measure(const std::function<void(uint32_t)>& operation) {
+        auto*    stats = qp_virtual_panel_stats(panel);
+        uint32_t count = iterations();
+
+        *stats     = {};
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < count; ++i) {
+            operation(i);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        qp_virtual_panel_stats_t per_call = {
+            .transactions = stats->transactions / count,
+            .commands     = stats->commands / count,
+            .sends        = stats->sends / count,
+            .bytes        = stats->bytes / count,
+            .pixels       = stats->pixels / count,
+        };
+        RecordProperty("ns_per_call", std::to_string(elapsed / count));
+        RecordProperty("transactions_per_call", std::to_string(per_call.transactions));
+        RecordProperty("commands_per_call", std::to_string(per_call.commands));
+        RecordProperty("sends_per_call", std::to_string(per_call.sends));
+        RecordProperty("bytes_per_call", std::to_string(per_call.bytes));
+        RecordProperty("pixels_per_call", std::to_string(per_call.pixels));
+        return per_call;
+    }
+};
+
+TEST_F(PainterBenchmark, DrawText) {
+    auto cost = measure([](uint32_t i) { qp_drawtext_recolor(panel, 0, (i * 16) % 112, font, "The quick brown fox", HSV_WHITE, HSV_BLACK); });
+    EXPECT_GT(cost.pixels, 0) << "Text was not drawn";
+}
+
+TEST_F(PainterBenchmark, DrawImage) {
+    auto cost = measure([](uint32_t i) { qp_drawimage(panel, (i * 10) % 90, 0, logo); });
+    EXPECT_EQ(cost.pixels, logo->width * logo->height) << "Image should be sent exactly once";
+}
+
+TEST_F(PainterBenchmark, DrawImageRecolor) {
+    auto cost = measure([](uint32_t i) { qp_drawimage_recolor(panel, (i * 10) % 90, 0, logo, i % 256, 255, 255, HSV_BLACK); });
+    EXPECT_EQ(cost.pixels, logo->width * logo->height) << "Image should be sent exactly once";
+}
+
+TEST_F(PainterBenchmark, CircleFilled) {
+    auto cost = measure([](uint32_t i) { qp_circle(panel, 64, 64, 60, i % 256, 255, 255, true); });
+    EXPECT_GT(cost.pixels, 0) << "Circle was not drawn";
+}
+
+TEST_F(PainterBenchmark, CircleOutline) {
+    auto cost = measure([](uint32_t i) { qp_circle(panel, 64, 64, 60, i % 256, 255, 255, false); });
+    EXPECT_GT(cost.pixels, 0) << "Circle was not drawn";
+}
+
+TEST_F(PainterBenchmark, EllipseFilled) {
+    auto cost = measure([](uint32_t i) { qp_ellipse(panel, 80, 64, 76, 40, i % 256, 255, 255, true); });
+    EXPECT_GT(cost.pixels, 0) << "Ellipse was not drawn";
+}
+
+TEST_F(PainterBenchmark, EllipseOutline) {
+    auto cost = measure([](uint32_t i) { qp_ellipse(panel, 80, 64, 76, 40, i % 256, 255, 255, false); });
+    EXPECT_GT(cost.pixels, 0) << "Ellipse was not drawn";
+}
+
+TEST_F(PainterBenchmark, RectFilled) {
+    auto cost = measure([](uint32_t i) { qp_rect(panel, 0, 0, TEST_PANEL_WIDTH - 1, TEST_PANEL_HEIGHT - 1, i % 256, 255, 255, true); });
+    EXPECT_EQ(cost.pixels, TEST_PANEL_WIDTH * TEST_PANEL_HEIGHT) << "Rectangle should cover the panel exactly once";
+}
+
+TEST_F(PainterBenchmark, SurfaceFullFlush) {
+    auto cost = measure([](uint32_t i) {
+        if (i & 1) {
+            qp_rect(rgb565, 0, 0, TEST_PANEL_WIDTH - 1, TEST_PANEL_HEIGHT - 1, HSV_RED, true);
+        } else {
+            qp_rect(rgb565, 0, 0, TEST_PANEL_WIDTH - 1, TEST_PANEL_HEIGHT - 1, HSV_BLUE, true);
+        }
+        qp_surface_draw(rgb565, panel, 0, 0, false);
+    });
+    EXPECT_EQ(cost.pixels, TEST_PANEL_WIDTH * TEST_PANEL_HEIGHT) << "Surface should be sent exactly once";
+}
+
+TEST_F(PainterBenchmark, SurfacePartialFlush) {
+    auto cost = measure([](uint32_t i) {
+        qp_drawtext(rgb565, 4, 4, font, (i & 1) ? "12:34" : "12:35");
+        qp_surface_draw(rgb565, panel, 0, 0, false);
+    });
+    EXPECT_LT(cost.pixels, TEST_PANEL_WIDTH * TEST_PANEL_HEIGHT / 4) << "Only the changed text should be sent";
+}
+
+TEST_F(PainterBenchmark, MonoSurfaceDraw) {
+    // The mono surface is never flushed to the panel, so only the CPU cost of drawing into it is measured
+    auto cost = measure([](uint32_t i) {
+        qp_rect(mono, 0, 0, TEST_MONO_WIDTH - 1, TEST_MONO_HEIGHT - 1, HSV_BLACK, true);
+        qp_circle(mono, 32, 32, 30, HSV_WHITE, false);
+        qp_drawtext(mono, 68, 24, font, "QMK");
+    });
+    EXPECT_EQ(cost.pixels, 0) << "Panel should be untouched";
+}
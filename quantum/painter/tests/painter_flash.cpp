@@ -0,0 +1,121 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include <cstring>
+
+#include "painter_test_common.hpp"
+
+extern "C" {
+#include "flash_spi.h"
+#include "qp_stream.h"
+
+extern const uint8_t  flash_assets[];
+extern const uint32_t flash_assets_length;
+}
+
+// Contents of the external flash, with the packed assets at the directory address
+static std::array<uint8_t, EXTERNAL_FLASH_SIZE> flash_contents;
+static uint32_t                                 flash_reads;
+
+extern "C" flash_status_t flash_read_block(uint32_t addr, void* buf, size_t len) {
+    if (addr + len > flash_contents.size()) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+    memcpy(buf, &flash_contents[addr], len);
+    flash_reads++;
+    return FLASH_STATUS_SUCCESS;
+}
+
+class PainterFlash : public PainterTest {
+   protected:
+    void SetUp() override {
+        PainterTest::SetUp();
+        flash_contents.fill(0xFF);
+        memcpy(&flash_contents[QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS], flash_assets, flash_assets_length);
+        qp_flash_stream_invalidate();
+        flash_reads = 0;
+    }
+
+    // Overwrites the offset and length of the given directory entry, as a corrupt or truncated image would
+    static void patch_entry(uint16_t index, uint32_t offset, uint32_t length) {
+        qp_flash_directory_entry_v1_t entry;
+        uint32_t                      address = QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS + sizeof(qp_flash_directory_header_v1_t) + index * sizeof(entry);
+        memcpy(&entry, &flash_contents[address], sizeof(entry));
+        entry.offset = offset;
+        entry.length = length;
+        memcpy(&flash_contents[address], &entry, sizeof(entry));
+        qp_flash_stream_invalidate();
+    }
+
+    static uint32_t draw_image(painter_image_handle_t image) {
+        qp_rect(rgb565, 0, 0, TEST_PANEL_WIDTH - 1, TEST_PANEL_HEIGHT - 1, HSV_BLACK, true);
+        EXPECT_TRUE(qp_drawimage_recolor(rgb565, 0, 0, image, HSV_RED, HSV_BLUE)) << "Failed to draw image";
+        return frame_hash(rgb565_buffer, sizeof(rgb565_buffer));
+    }
+
+    static uint32_t draw_text(painter_font_handle_t text_font) {
+        qp_rect(rgb565, 0, 0, TEST_PANEL_WIDTH - 1, TEST_PANEL_HEIGHT - 1, HSV_BLACK, true);
+        EXPECT_GT(qp_drawtext(rgb565, 2, 2, text_font, "Quantum Painter"), 0) << "Failed to draw text";
+        return frame_hash(rgb565_buffer, sizeof(rgb565_buffer));
+    }
+};
+
+/**
+ * This test verifies that an image packed by `qmk painter-pack-assets` is found by name and draws the same as when it
+ * is loaded from memory.
+ */
+TEST_F(PainterFlash, LoadsPackedImage) {
+    painter_image_handle_t image = qp_load_image_flash("ghoul-logo");
+    ASSERT_NE(image, nullptr) << "Could not load image from flash";
+    EXPECT_EQ(image->width, logo->width) << "Image width did not match";
+    EXPECT_EQ(image->height, logo->height) << "Image height did not match";
+    EXPECT_EQ(draw_image(image), draw_image(logo)) << "Image from flash did not match image from memory";
+    EXPECT_GT(flash_reads, 0) << "Image was not read from flash";
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+/**
+ * This test verifies that a font packed by `qmk painter-pack-assets` is found by name and draws the same as when it is
+ * loaded from memory.
+ */
+TEST_F(PainterFlash, LoadsPackedFont) {
+    painter_font_handle_t flash_font = qp_load_font_flash("thintel15");
+    ASSERT_NE(flash_font, nullptr) << "Could not load font from flash";
+    EXPECT_EQ(draw_text(flash_font), draw_text(font)) << "Font from flash did not match font from memory";
+    EXPECT_TRUE(qp_close_font(flash_font));
+}
+
+/**
+ * This test verifies that assets missing from the directory, or an image without a directory, fail to load.
+ */
+TEST_F(PainterFlash, MissingAssetsFail) {
+    EXPECT_EQ(qp_load_image_flash("ghoul"), nullptr) << "Loaded an asset which isn't in the directory";
+    EXPECT_EQ(qp_load_image_flash("thintel15"), nullptr) << "Loaded a font as an image";
+
+    flash_contents.fill(0xFF);
+    qp_flash_stream_invalidate();
+    EXPECT_EQ(qp_load_image_flash("ghoul-logo"), nullptr) << "Loaded an asset from blank flash";
+}
+
+/**
+ * This test verifies that directory entries reaching past the end of flash are rejected, including ones where the
+ * offset and length only fit once they wrap around.
+ */
+TEST_F(PainterFlash, OutOfBoundsEntriesFail) {
+    const uint32_t    directory_length = EXTERNAL_FLASH_SIZE - QUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS;
+    qp_flash_stream_t stream;
+
+    patch_entry(0, 0x100, directory_length);
+    EXPECT_FALSE(qp_make_flash_asset_stream(&stream, "ghoul-logo")) << "Accepted an asset longer than the flash";
+
+    patch_entry(0, directory_length + 0x100, 0x10);
+    EXPECT_FALSE(qp_make_flash_asset_stream(&stream, "ghoul-logo")) << "Accepted an asset starting past the end of the flash";
+
+    patch_entry(0, 0xFFFFFF00, 0x200);
+    EXPECT_FALSE(qp_make_flash_asset_stream(&stream, "ghoul-logo")) << "Accepted an asset wrapping around the end of the flash";
+
+    patch_entry(0, directory_length - 0x10, 0x10);
+    EXPECT_TRUE(qp_make_flash_asset_stream(&stream, "ghoul-logo")) << "Rejected an asset ending at the end of the flash";
+    EXPECT_EQ(stream.address, EXTERNAL_FLASH_SIZE - 0x10) << "Asset stream started at the wrong address";
+    EXPECT_EQ(stream.length, 0x10) << "Asset stream had the wrong length";
+}
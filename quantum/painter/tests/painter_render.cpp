@@ -0,0 +1,312 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <vector>
+
+#include "painter_test_common.hpp"
+
+extern "C" {
+extern const uint8_t font_thintel15_unicode[];
+}
+
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+extern "C" {
+#    include "qgf.h"
+extern const uint32_t gfx_ghoul_logo_length;
+}
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
+/*
+    Golden frames are stored as FNV-1a hashes of the rendered framebuffer. If a change to the renderer intentionally
+    alters the output, rerun with QP_FRAME_DUMP_DIR set, inspect the dumped frames, and update the hashes below.
+*/
+#define GOLDEN_PRIMITIVES 0x35E816E6
+#define GOLDEN_IMAGE 0xCBC86715
+#define GOLDEN_TEXT 0xC718A978
+#define GOLDEN_MONO_SCENE 0x103F472B
+
+class PainterRender : public PainterTest {
+   protected:
+    static void draw_primitives(painter_device_t device) {
+        qp_rect(device, 0, 0, 159, 127, 0, 0, 0, true);
+        qp_rect(device, 4, 4, 51, 35, HSV_RED, true);
+        qp_rect(device, 56, 4, 103, 35, HSV_GREEN, false);
+        qp_line(device, 108, 4, 155, 35, HSV_BLUE);
+        qp_line(device, 108, 35, 155, 4, HSV_YELLOW);
+        qp_circle(device, 27, 70, 22, HSV_CYAN, true);
+        qp_circle(device, 79, 70, 22, HSV_MAGENTA, false);
+        qp_ellipse(device, 131, 70, 24, 14, HSV_ORANGE, true);
+        qp_ellipse(device, 80, 110, 60, 12, HSV_WHITE, false);
+        for (uint16_t i = 0; i < 16; ++i) {
+            qp_setpixel(device, 4 + i * 2, 124, i * 16, 255, 255);
+        }
+    }
+
+    static void draw_text(painter_device_t device, painter_font_handle_t text_font) {
+        int16_t width = qp_textwidth(text_font, "Hello, world!");
+        EXPECT_GT(width, 0) << "Invalid text width";
+        EXPECT_EQ(qp_drawtext(device, 4, 4, text_font, "Hello, world!"), width) << "Text was not drawn to its full width";
+        qp_drawtext_recolor(device, 4, 24, text_font, "0123456789", HSV_GREEN, HSV_BLACK);
+        qp_drawtext_recolor(device, 4, 44, text_font, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", HSV_BLACK, HSV_GOLD);
+    }
+
+    static void draw_scene(painter_device_t device) {
+        draw_primitives(device);
+        qp_drawimage_recolor(device, 90, 0, logo, HSV_WHITE, HSV_BLACK);
+        qp_drawtext(device, 2, 2, font, "Quantum Painter");
+    }
+};
+
+/**
+ * This test verifies that the basic primitives render as expected through the TFT panel code.
+ */
+TEST_F(PainterRender, Primitives) {
+    draw_primitives(panel);
+    qp_flush(panel);
+    dump_panel("panel");
+    EXPECT_EQ(panel_hash(), GOLDEN_PRIMITIVES) << "Primitives did not match the golden frame";
+}
+
+/**
+ * This test verifies that images are decoded and recoloured as expected.
+ */
+TEST_F(PainterRender, Image) {
+    EXPECT_TRUE(qp_drawimage(panel, 0, 0, logo)) << "Failed to draw image";
+    EXPECT_TRUE(qp_drawimage_recolor(panel, 80, 0, logo, HSV_RED, HSV_BLUE)) << "Failed to draw recoloured image";
+    qp_flush(panel);
+    dump_panel("panel");
+    EXPECT_EQ(panel_hash(), GOLDEN_IMAGE) << "Image did not match the golden frame";
+}
+
+/**
+ * This test verifies that text is laid out and rendered as expected.
+ */
+TEST_F(PainterRender, Text) {
+    draw_text(panel, font);
+    qp_flush(panel);
+    dump_panel("panel");
+    EXPECT_EQ(panel_hash(), GOLDEN_TEXT) << "Text did not match the golden frame";
+}
+
+/**
+ * This test verifies that a font with a unicode glyph table still draws its ASCII glyphs as expected, that the unicode
+ * glyphs are measured and drawn the same as the ASCII glyphs whose data they share, and that code points missing from
+ * the table are rejected.
+ */
+TEST_F(PainterRender, UnicodeText) {
+    painter_font_handle_t unicode_font = qp_load_font_mem(font_thintel15_unicode);
+    ASSERT_NE(unicode_font, nullptr) << "Could not load font";
+
+    draw_text(panel, unicode_font);
+    qp_flush(panel);
+    EXPECT_EQ(panel_hash(), GOLDEN_TEXT) << "ASCII text did not match the golden frame";
+    qp_rect(panel, 0, 0, TEST_PANEL_WIDTH - 1, TEST_PANEL_HEIGHT - 1, HSV_BLACK, true);
+
+    const char* unicode_text = "Caf\u00E9 \u2192 20\u00B0 \U0001F642 \u00C9t\u00E9";
+    const char* ascii_text   = "Cafe > 20o : Ete";
+    int16_t     width        = qp_textwidth(font, ascii_text);
+    EXPECT_GT(width, 0) << "Invalid text width";
+    EXPECT_EQ(qp_textwidth(unicode_font, unicode_text), width) << "Unicode text width did not match";
+    EXPECT_EQ(qp_textwidth(unicode_font, "\u00E8"), 0) << "Measured a glyph missing from the font";
+    EXPECT_EQ(qp_textwidth(unicode_font, "\U0001F643"), 0) << "Measured a glyph missing from the font";
+
+    EXPECT_EQ(qp_drawtext(panel, 4, 4, font, ascii_text), width) << "Text was not drawn to its full width";
+    qp_flush(panel);
+    uint32_t ascii = panel_hash();
+
+    qp_rect(panel, 0, 0, TEST_PANEL_WIDTH - 1, TEST_PANEL_HEIGHT - 1, HSV_BLACK, true);
+    EXPECT_EQ(qp_drawtext(panel, 4, 4, unicode_font, unicode_text), width) << "Unicode text was not drawn to its full width";
+    qp_flush(panel);
+    dump_panel("panel");
+    EXPECT_EQ(panel_hash(), ascii) << "Unicode text did not match the equivalent ASCII text";
+
+    EXPECT_TRUE(qp_close_font(unicode_font));
+}
+
+/**
+ * This test verifies that drawing onto the monochrome surface renders as expected.
+ */
+TEST_F(PainterRender, MonoSurface) {
+    qp_rect(mono, 0, 0, 127, 63, HSV_WHITE, false);
+    qp_circle(mono, 20, 32, 14, HSV_WHITE, true);
+    qp_ellipse(mono, 60, 32, 20, 10, HSV_WHITE, false);
+    qp_line(mono, 84, 4, 123, 59, HSV_WHITE);
+    qp_drawtext(mono, 84, 40, font, "QMK");
+    dump_mono("mono");
+    EXPECT_EQ(mono_hash(), GOLDEN_MONO_SCENE) << "Monochrome surface did not match the golden frame";
+}
+
+/**
+ * This test verifies that drawing to a surface and then flushing it to the panel matches drawing to the panel directly.
+ */
+TEST_F(PainterRender, SurfaceMatchesDirect) {
+    draw_scene(panel);
+    qp_flush(panel);
+    uint32_t direct = panel_hash();
+    dump_panel("direct");
+
+    qp_init(panel, QP_ROTATION_0);
+    draw_scene(rgb565);
+    EXPECT_TRUE(qp_surface_draw(rgb565, panel, 0, 0, false)) << "Failed to draw surface";
+    dump_panel("surface");
+    EXPECT_EQ(panel_hash(), direct) << "Surface output differs from direct drawing";
+}
+
+/**
+ * This test verifies that a surface only transfers what changed since it was last drawn.
+ */
+TEST_F(PainterRender, SurfaceTransfersDirtyRegion) {
+    auto* stats = qp_virtual_panel_stats(panel);
+    qp_rect(rgb565, 0, 0, 159, 127, HSV_BLUE, true);
+    EXPECT_TRUE(qp_surface_draw(rgb565, panel, 0, 0, false)) << "Failed to draw surface";
+    EXPECT_EQ(stats->pixels, TEST_PANEL_WIDTH * TEST_PANEL_HEIGHT) << "Full surface was not transferred";
+
+    *stats = {};
+    qp_rect(rgb565, 10, 20, 29, 29, HSV_RED, true);
+    EXPECT_TRUE(qp_surface_draw(rgb565, panel, 0, 0, false)) << "Failed to draw surface";
+    EXPECT_EQ(stats->pixels, 20 * 10) << "Only the dirty region should have been transferred";
+
+    *stats = {};
+    EXPECT_TRUE(qp_surface_draw(rgb565, panel, 0, 0, false)) << "Failed to draw surface";
+    EXPECT_EQ(stats->pixels, 0) << "Clean surface should not have been transferred";
+
+    EXPECT_EQ(panel_framebuffer[25 * TEST_PANEL_WIDTH + 15], 0xF800) << "Dirty region was not transferred correctly";
+    EXPECT_EQ(panel_framebuffer[5 * TEST_PANEL_WIDTH + 5], 0x001F) << "Clean region was overwritten";
+}
+
+/**
+ * This test verifies that separate regions drawn on a surface are transferred on their own, rather than as the area
+ * spanning both of them.
+ */
+TEST_F(PainterRender, SurfaceTransfersDistantRegions) {
+    auto* stats = qp_virtual_panel_stats(panel);
+    qp_rect(rgb565, 0, 0, 159, 127, HSV_BLUE, true);
+    EXPECT_TRUE(qp_surface_draw(rgb565, panel, 0, 0, false)) << "Failed to draw surface";
+
+    *stats = {};
+    qp_rect(rgb565, 4, 4, 23, 13, HSV_RED, true);
+    qp_rect(rgb565, 120, 100, 149, 119, HSV_GREEN, true);
+    EXPECT_TRUE(qp_surface_draw(rgb565, panel, 0, 0, false)) << "Failed to draw surface";
+    EXPECT_EQ(stats->pixels, 20 * 10 + 30 * 20) << "Only the two dirty regions should have been transferred";
+
+    EXPECT_EQ(panel_framebuffer[8 * TEST_PANEL_WIDTH + 10], 0xF800) << "First dirty region was not transferred correctly";
+    EXPECT_EQ(panel_framebuffer[110 * TEST_PANEL_WIDTH + 135], 0x07E0) << "Second dirty region was not transferred correctly";
+    EXPECT_EQ(panel_framebuffer[60 * TEST_PANEL_WIDTH + 80], 0x001F) << "Clean region was overwritten";
+}
+
+/**
+ * This test verifies that drawing more separate regions than a surface can track still transfers everything that
+ * changed, matching drawing to the panel directly.
+ */
+TEST_F(PainterRender, SurfaceTransfersOverflowingRegions) {
+    // A 4x3 grid of small rectangles, far enough apart that none of them are merged when they're first marked dirty
+    static constexpr uint16_t columns = 4, rows = 3;
+    static_assert(columns * rows > SURFACE_DIRTY_RECTS, "Test needs more regions than the surface can track");
+    auto draw_regions = [](painter_device_t device) {
+        for (uint16_t i = 0; i < columns * rows; ++i) {
+            uint16_t x = 4 + (i % columns) * 40, y = 4 + (i / columns) * 42;
+            qp_rect(device, x, y, x + 11 + i, y + 7 + i / 2, i * 20, 255, 255, true);
+        }
+    };
+
+    qp_rect(panel, 0, 0, 159, 127, HSV_BLUE, true);
+    draw_regions(panel);
+    qp_flush(panel);
+    uint32_t direct = panel_hash();
+    dump_panel("direct");
+
+    qp_init(panel, QP_ROTATION_0);
+    qp_rect(rgb565, 0, 0, 159, 127, HSV_BLUE, true);
+    EXPECT_TRUE(qp_surface_draw(rgb565, panel, 0, 0, false)) << "Failed to draw surface";
+    draw_regions(rgb565);
+    EXPECT_TRUE(qp_surface_draw(rgb565, panel, 0, 0, false)) << "Failed to draw surface";
+    dump_panel("surface");
+    EXPECT_EQ(panel_hash(), direct) << "Surface output differs from direct drawing";
+}
+
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
+class PainterImageCache : public PainterRender {
+   protected:
+    // Writable copy of the logo, so that tests can tell whether a redraw was decoded from it again
+    std::vector<uint8_t> image_data{gfx_ghoul_logo, gfx_ghoul_logo + gfx_ghoul_logo_length};
+
+    static uint32_t draw_image(painter_image_handle_t image, uint8_t hue_fg) {
+        qp_rect(panel, 0, 0, TEST_PANEL_WIDTH - 1, TEST_PANEL_HEIGHT - 1, HSV_BLACK, true);
+        EXPECT_TRUE(qp_drawimage_recolor(panel, 0, 0, image, hue_fg, 255, 255, HSV_BLACK)) << "Failed to draw image";
+        qp_flush(panel);
+        return panel_hash();
+    }
+
+    // Changes the pixel data of the first RLE run, leaving the image valid but drawing differently
+    void modify_image_data() {
+        uint32_t offset = sizeof(qgf_graphics_descriptor_v1_t) + sizeof(qgf_frame_offsets_v1_t) + sizeof(uint32_t) + sizeof(qgf_frame_v1_t) + sizeof(qgf_data_v1_t);
+        ASSERT_LT(image_data[offset], 128) << "Expected the image data to start with a repeated run";
+        image_data[offset + 1] ^= 0xFF;
+    }
+};
+
+/**
+ * This test verifies that redrawing a cached image produces the same frame, without decoding the image data again.
+ */
+TEST_F(PainterImageCache, RedrawMatchesDecoded) {
+    painter_image_handle_t image = qp_load_image_mem(image_data.data());
+    ASSERT_NE(image, nullptr) << "Could not load image";
+
+    EXPECT_TRUE(qp_drawimage(panel, 0, 0, image)) << "Failed to draw image";
+    EXPECT_TRUE(qp_drawimage_recolor(panel, 80, 0, image, HSV_RED, HSV_BLUE)) << "Failed to draw recoloured image";
+    qp_flush(panel);
+    EXPECT_EQ(panel_hash(), GOLDEN_IMAGE) << "Image did not match the golden frame";
+
+    modify_image_data();
+    qp_rect(panel, 0, 0, TEST_PANEL_WIDTH - 1, TEST_PANEL_HEIGHT - 1, HSV_BLACK, true);
+    *qp_virtual_panel_stats(panel) = {};
+    EXPECT_TRUE(qp_drawimage(panel, 0, 0, image)) << "Failed to draw cached image";
+    EXPECT_TRUE(qp_drawimage_recolor(panel, 80, 0, image, HSV_RED, HSV_BLUE)) << "Failed to draw cached recoloured image";
+    qp_flush(panel);
+    dump_panel("panel");
+    EXPECT_EQ(panel_hash(), GOLDEN_IMAGE) << "Cached image did not match the golden frame";
+    EXPECT_EQ(qp_virtual_panel_stats(panel)->pixels, 2u * image->width * image->height) << "Cached image was not transferred in full";
+
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+/**
+ * This test verifies that the least recently used frame is evicted once the cache is full, and is decoded again when
+ * it is next drawn.
+ */
+TEST_F(PainterImageCache, EvictionDropsEntries) {
+    painter_image_handle_t image = qp_load_image_mem(image_data.data());
+    ASSERT_NE(image, nullptr) << "Could not load image";
+
+    uint32_t original = draw_image(image, 0);
+    EXPECT_EQ(draw_image(image, 85), draw_image(image, 85)) << "Cached image did not match the decoded image";
+    modify_image_data();
+    EXPECT_EQ(draw_image(image, 0), original) << "Image should still have been cached";
+
+    // The cache holds two frames of the logo, so drawing two other colours pushes out the original one
+    draw_image(image, 85);
+    draw_image(image, 170);
+    EXPECT_NE(draw_image(image, 0), original) << "Evicted image was not decoded again";
+
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+/**
+ * This test verifies that closing an image drops its cached frames, so that an image later loaded into the same slot
+ * isn't drawn from them.
+ */
+TEST_F(PainterImageCache, CloseDropsEntries) {
+    painter_image_handle_t image = qp_load_image_mem(image_data.data());
+    ASSERT_NE(image, nullptr) << "Could not load image";
+    uint32_t original = draw_image(image, 0);
+    EXPECT_TRUE(qp_close_image(image));
+
+    modify_image_data();
+    painter_image_handle_t reloaded = qp_load_image_mem(image_data.data());
+    ASSERT_EQ(reloaded, image) << "Expected the image to be loaded into the same slot";
+    EXPECT_NE(draw_image(reloaded, 0), original) << "Reloaded image was drawn from the closed image's cache";
+
+    EXPECT_TRUE(qp_close_image(reloaded));
+}
+
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
@@ -0,0 +1,144 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "color.h"
+#include "qp_virtual_panel.h"
+#include "fnv.h"
+
+extern const uint8_t gfx_ghoul_logo[];
+extern const uint8_t font_thintel15[];
+}
+
+#define TEST_PANEL_WIDTH 160
+#define TEST_PANEL_HEIGHT 128
+#define TEST_MONO_WIDTH 128
+#define TEST_MONO_HEIGHT 64
+
+/*
+    Devices are allocated from static pools that can't be returned, so every
+    test in the binary shares the same virtual panel and surfaces:
+
+    - panel:  virtual RGB565 panel, fed through the common TFT panel code
+    - rgb565: RGB565 surface of the same size as the panel
+    - mono:   1bpp monochrome surface
+
+    Frames can be written out as PPM/PBM images for inspection by pointing
+    QP_FRAME_DUMP_DIR to an existing directory.
+*/
+class PainterTest : public ::testing::Test {
+   protected:
+    static uint16_t panel_framebuffer[TEST_PANEL_WIDTH * TEST_PANEL_HEIGHT];
+    static uint8_t  rgb565_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_PANEL_WIDTH, TEST_PANEL_HEIGHT, 16)];
+    static uint8_t  mono_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_MONO_WIDTH, TEST_MONO_HEIGHT, 1)];
+
+    static painter_device_t       panel;
+    static painter_device_t       rgb565;
+    static painter_device_t       mono;
+    static painter_image_handle_t logo;
+    static painter_font_handle_t  font;
+
+    static void SetUpTestSuite() {
+        if (!panel) {
+            panel  = qp_virtual_panel_make_device(TEST_PANEL_WIDTH, TEST_PANEL_HEIGHT, panel_framebuffer);
+            rgb565 = qp_make_rgb565_surface(TEST_PANEL_WIDTH, TEST_PANEL_HEIGHT, rgb565_buffer);
+            mono   = qp_make_mono1bpp_surface(TEST_MONO_WIDTH, TEST_MONO_HEIGHT, mono_buffer);
+            logo   = qp_load_image_mem(gfx_ghoul_logo);
+            font   = qp_load_font_mem(font_thintel15);
+        }
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(panel && rgb565 && mono) << "Could not create devices";
+        ASSERT_TRUE(logo && font) << "Could not load assets";
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(rgb565, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mono, QP_ROTATION_0));
+        // Surfaces start off dirty, so that they're flushed in full the first time
+        qp_flush(rgb565);
+        qp_flush(mono);
+        *qp_virtual_panel_stats(panel) = {};
+    }
+
+    static uint32_t frame_hash(const void* data, size_t length) {
+        return fnv_32a_buf(const_cast<void*>(data), length, FNV1_32A_INIT);
+    }
+
+    static uint32_t panel_hash(void) {
+        return frame_hash(panel_framebuffer, sizeof(panel_framebuffer));
+    }
+
+    static uint32_t mono_hash(void) {
+        return frame_hash(mono_buffer, sizeof(mono_buffer));
+    }
+
+    static std::string dump_path(const char* name, const char* extension) {
+        const char* dir = getenv("QP_FRAME_DUMP_DIR");
+        if (!dir || !*dir) {
+            return std::string();
+        }
+        const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        return std::string(dir) + "/" + info->test_suite_name() + "_" + info->name() + "_" + name + extension;
+    }
+
+    static void dump_rgb565(const char* name, const uint16_t* pixels, uint16_t width, uint16_t height) {
+        std::string path = dump_path(name, ".ppm");
+        FILE*       f    = path.empty() ? nullptr : fopen(path.c_str(), "wb");
+        if (!f) {
+            return;
+        }
+        fprintf(f, "P6\n%d %d\n255\n", width, height);
+        for (uint32_t i = 0; i < (uint32_t)width * height; ++i) {
+            uint16_t      p     = pixels[i];
+            const uint8_t rgb[] = {(uint8_t)(((p >> 11) & 0x1F) * 255 / 31), (uint8_t)(((p >> 5) & 0x3F) * 255 / 63), (uint8_t)((p & 0x1F) * 255 / 31)};
+            fwrite(rgb, 1, sizeof(rgb), f);
+        }
+        fclose(f);
+    }
+
+    static void dump_mono(const char* name, const uint8_t* bits, uint16_t width, uint16_t height) {
+        std::string path = dump_path(name, ".pbm");
+        FILE*       f    = path.empty() ? nullptr : fopen(path.c_str(), "wb");
+        if (!f) {
+            return;
+        }
+        // Plain PBM, 1 is black -- the surface stores lit pixels as 1, so invert to match the display
+        fprintf(f, "P1\n%d %d\n", width, height);
+        for (uint32_t y = 0; y < height; ++y) {
+            for (uint32_t x = 0; x < width; ++x) {
+                uint32_t n = y * width + x;
+                fputc((bits[n / 8] & (1 << (n % 8))) ? '0' : '1', f);
+            }
+            fputc('\n', f);
+        }
+        fclose(f);
+    }
+
+    static void dump_panel(const char* name) {
+        dump_rgb565(name, panel_framebuffer, TEST_PANEL_WIDTH, TEST_PANEL_HEIGHT);
+    }
+
+    static void dump_mono(const char* name) {
+        dump_mono(name, mono_buffer, TEST_MONO_WIDTH, TEST_MONO_HEIGHT);
+    }
+};
+
+inline uint16_t PainterTest::panel_framebuffer[TEST_PANEL_WIDTH * TEST_PANEL_HEIGHT];
+inline uint8_t  PainterTest::rgb565_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_PANEL_WIDTH, TEST_PANEL_HEIGHT, 16)];
+inline uint8_t  PainterTest::mono_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_MONO_WIDTH, TEST_MONO_HEIGHT, 1)];
+
+inline painter_device_t       PainterTest::panel  = nullptr;
+inline painter_device_t       PainterTest::rgb565 = nullptr;
+inline painter_device_t       PainterTest::mono   = nullptr;
+inline painter_image_handle_t PainterTest::logo   = nullptr;
+inline painter_font_handle_t  PainterTest::font   = nullptr;
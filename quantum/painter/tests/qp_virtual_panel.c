@@ -0,0 +1,231 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "qp_comms.h"
+#include "qp_tft_panel.h"
+#include "qp_virtual_panel.h"
+
+#define VIRTUAL_PANEL_NUM_DEVICES 2
+
+// MIPI DCS opcodes understood by the virtual panel
+#define DCS_DISPLAY_OFF 0x28
+#define DCS_DISPLAY_ON 0x29
+#define DCS_SET_COLUMN_ADDRESS 0x2A
+#define DCS_SET_ROW_ADDRESS 0x2B
+#define DCS_WRITE_MEMORY 0x2C
+
+typedef struct virtual_panel_device_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    uint16_t *               framebuffer;
+    qp_virtual_panel_stats_t stats;
+
+    // Command currently being received, and its parameters
+    uint8_t command;
+    uint8_t params[4];
+    uint8_t num_params;
+
+    // Address window, and the write position within it
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+    uint16_t x;
+    uint16_t y;
+
+    // First byte of a pixel, while waiting for the second
+    bool    has_high_byte;
+    uint8_t high_byte;
+} virtual_panel_device_t;
+
+static virtual_panel_device_t virtual_panel_devices[VIRTUAL_PANEL_NUM_DEVICES];
+static uint8_t                virtual_panel_count = 0;
+
+static uint16_t virtual_panel_width(virtual_panel_device_t *panel) {
+    bool sideways = panel->base.rotation == QP_ROTATION_90 || panel->base.rotation == QP_ROTATION_270;
+    return sideways ? panel->base.panel_height : panel->base.panel_width;
+}
+
+static uint16_t virtual_panel_height(virtual_panel_device_t *panel) {
+    bool sideways = panel->base.rotation == QP_ROTATION_90 || panel->base.rotation == QP_ROTATION_270;
+    return sideways ? panel->base.panel_width : panel->base.panel_height;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Virtual comms, decoding what the panel receives
+
+static bool virtual_panel_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool virtual_panel_comms_start(painter_device_t device) {
+    virtual_panel_device_t *panel = (virtual_panel_device_t *)device;
+    panel->stats.transactions++;
+    return true;
+}
+
+static void virtual_panel_comms_stop(painter_device_t device) {
+    // No-op.
+}
+
+static void virtual_panel_send_command(painter_device_t device, uint8_t cmd) {
+    virtual_panel_device_t *panel = (virtual_panel_device_t *)device;
+    panel->stats.commands++;
+    panel->command       = cmd;
+    panel->num_params    = 0;
+    panel->has_high_byte = false;
+
+    if (cmd == DCS_WRITE_MEMORY) {
+        panel->x = panel->left;
+        panel->y = panel->top;
+    }
+}
+
+static void virtual_panel_write_pixel(virtual_panel_device_t *panel, uint16_t rgb565) {
+    if (panel->x < virtual_panel_width(panel) && panel->y < virtual_panel_height(panel)) {
+        panel->framebuffer[panel->y * virtual_panel_width(panel) + panel->x] = rgb565;
+    }
+    panel->stats.pixels++;
+
+    // Wrap around within the address window, as the panel would
+    if (++panel->x > panel->right) {
+        panel->x = panel->left;
+        if (++panel->y > panel->bottom) {
+            panel->y = panel->top;
+        }
+    }
+}
+
+static uint32_t virtual_panel_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    virtual_panel_device_t *panel = (virtual_panel_device_t *)device;
+    const uint8_t *         p     = (const uint8_t *)data;
+    panel->stats.sends++;
+    panel->stats.bytes += byte_count;
+
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        switch (panel->command) {
+            case DCS_SET_COLUMN_ADDRESS:
+            case DCS_SET_ROW_ADDRESS:
+                if (panel->num_params < sizeof(panel->params)) {
+                    panel->params[panel->num_params++] = p[i];
+                }
+                if (panel->num_params == sizeof(panel->params)) {
+                    uint16_t start = ((uint16_t)panel->params[0]) << 8 | panel->params[1];
+                    uint16_t end   = ((uint16_t)panel->params[2]) << 8 | panel->params[3];
+                    if (panel->command == DCS_SET_COLUMN_ADDRESS) {
+                        panel->left  = start;
+                        panel->right = end;
+                    } else {
+                        panel->top    = start;
+                        panel->bottom = end;
+                    }
+                }
+                break;
+
+            case DCS_WRITE_MEMORY:
+                if (panel->has_high_byte) {
+                    virtual_panel_write_pixel(panel, ((uint16_t)panel->high_byte) << 8 | p[i]);
+                    panel->has_high_byte = false;
+                } else {
+                    panel->high_byte     = p[i];
+                    panel->has_high_byte = true;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return byte_count;
+}
+
+static void virtual_panel_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+    // Same layout as the SPI D/C implementation: command, delay, number of parameters, parameters
+    for (size_t i = 0; i + 2 < sequence_len;) {
+        uint8_t command   = sequence[i];
+        uint8_t num_bytes = sequence[i + 2];
+        virtual_panel_send_command(device, command);
+        if (num_bytes > 0) {
+            virtual_panel_comms_send(device, &sequence[i + 3], num_bytes);
+        }
+        i += 3 + num_bytes;
+    }
+}
+
+static const painter_comms_with_command_vtable_t virtual_panel_comms_vtable = {
+    .base =
+        {
+            .comms_init  = virtual_panel_comms_init,
+            .comms_start = virtual_panel_comms_start,
+            .comms_send  = virtual_panel_comms_send,
+            .comms_stop  = virtual_panel_comms_stop,
+        },
+    .send_command          = virtual_panel_send_command,
+    .bulk_command_sequence = virtual_panel_bulk_command_sequence,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver, reusing the common TFT panel implementation
+
+static bool virtual_panel_init(painter_device_t device, painter_rotation_t rotation) {
+    virtual_panel_device_t *panel = (virtual_panel_device_t *)device;
+    memset(panel->framebuffer, 0, sizeof(uint16_t) * panel->base.panel_width * panel->base.panel_height);
+    panel->left   = 0;
+    panel->top    = 0;
+    panel->right  = virtual_panel_width(panel) - 1;
+    panel->bottom = virtual_panel_height(panel) - 1;
+    return true;
+}
+
+static const tft_panel_dc_reset_painter_driver_vtable_t virtual_panel_driver_vtable = {
+    .base =
+        {
+            .init            = virtual_panel_init,
+            .power           = qp_tft_panel_power,
+            .clear           = qp_tft_panel_clear,
+            .flush           = qp_tft_panel_flush,
+            .pixdata         = qp_tft_panel_pixdata,
+            .viewport        = qp_tft_panel_viewport,
+            .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
+            .append_pixels   = qp_tft_panel_append_pixels_rgb565,
+            .append_pixdata  = qp_tft_panel_append_pixdata,
+            .fill_pixels     = qp_internal_fill_pixels_rgb565,
+        },
+    .num_window_bytes   = 2,
+    .swap_window_coords = false,
+    .opcodes =
+        {
+            .display_on         = DCS_DISPLAY_ON,
+            .display_off        = DCS_DISPLAY_OFF,
+            .set_column_address = DCS_SET_COLUMN_ADDRESS,
+            .set_row_address    = DCS_SET_ROW_ADDRESS,
+            .enable_writes      = DCS_WRITE_MEMORY,
+        },
+};
+
+painter_device_t qp_virtual_panel_make_device(uint16_t panel_width, uint16_t panel_height, uint16_t *framebuffer) {
+    if (virtual_panel_count >= VIRTUAL_PANEL_NUM_DEVICES) {
+        return NULL;
+    }
+
+    virtual_panel_device_t *panel = &virtual_panel_devices[virtual_panel_count++];
+    memset(panel, 0, sizeof(virtual_panel_device_t));
+    panel->base.driver_vtable         = (const painter_driver_vtable_t *)&virtual_panel_driver_vtable;
+    panel->base.comms_vtable          = (const painter_comms_vtable_t *)&virtual_panel_comms_vtable;
+    panel->base.native_bits_per_pixel = 16; // RGB565
+    panel->base.panel_width           = panel_width;
+    panel->base.panel_height          = panel_height;
+    panel->base.rotation              = QP_ROTATION_0;
+    panel->base.offset_x              = 0;
+    panel->base.offset_y              = 0;
+    panel->framebuffer                = framebuffer;
+    return (painter_device_t)panel;
+}
+
+qp_virtual_panel_stats_t *qp_virtual_panel_stats(painter_device_t device) {
+    virtual_panel_device_t *panel = (virtual_panel_device_t *)device;
+    return &panel->stats;
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "qp_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Virtual RGB565 panel, for exercising Quantum Painter on the host.
+//
+// Behaves like a MIPI DCS panel driven over SPI with a D/C pin -- the common TFT panel code sends it column/row
+// address and memory write commands, followed by big-endian RGB565 pixel data, exactly as it would to real hardware.
+// The received pixels end up in a framebuffer in host byte order, one uint16_t per pixel, in drawing orientation.
+
+typedef struct qp_virtual_panel_stats_t {
+    uint32_t transactions; // Number of qp_comms_start()/qp_comms_stop() pairs
+    uint32_t commands;     // Number of commands received
+    uint32_t sends;        // Number of data transfers
+    uint32_t bytes;        // Number of data bytes received
+    uint32_t pixels;       // Number of pixels written to the framebuffer
+} qp_virtual_panel_stats_t;
+
+painter_device_t qp_virtual_panel_make_device(uint16_t panel_width, uint16_t panel_height, uint16_t *framebuffer);
+
+qp_virtual_panel_stats_t *qp_virtual_panel_stats(painter_device_t device);
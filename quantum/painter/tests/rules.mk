@@ -0,0 +1,98 @@
+painter_common_DEFS := \
+	-DMATRIX_ROWS=1 \
+	-DMATRIX_COLS=1 \
+	-DNO_DEBUG \
+	-DEEPROM_TEST_HARNESS \
+	-DQUANTUM_PAINTER_ENABLE \
+	-DQUANTUM_PAINTER_SURFACE_ENABLE \
+	-DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE \
+	-DQUANTUM_PAINTER_DISPLAY_TIMEOUT=0 \
+	-DSURFACE_NUM_DEVICES=2
+painter_common_SRC := \
+	$(LIB_PATH)/fnv/hash_32a.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/painter/tests/qp_virtual_panel.c \
+	$(QUANTUM_PATH)/painter/tests/ghoul-logo.qgf.c \
+	$(QUANTUM_PATH)/painter/tests/thintel15.qff.c \
+	$(QUANTUM_PATH)/painter/tests/thintel15-unicode.qff.c
+painter_common_INC := \
+	$(LIB_PATH)/fnv \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/generic \
+	$(DRIVER_PATH)/painter/comms \
+	$(DRIVER_PATH)/painter/tft_panel
+
+painter_render_DEFS := \
+	$(painter_common_DEFS)
+painter_render_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_render.cpp
+painter_render_INC := \
+	$(painter_common_INC)
+
+painter_render_image_cache_DEFS := \
+	$(painter_common_DEFS) \
+	-DQUANTUM_PAINTER_IMAGE_CACHE_SIZE=36864
+painter_render_image_cache_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_render.cpp
+painter_render_image_cache_INC := \
+	$(painter_common_INC)
+
+painter_render_glyph_index_DEFS := \
+	$(painter_common_DEFS) \
+	-DQUANTUM_PAINTER_FONT_GLYPH_INDEX=1
+painter_render_glyph_index_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_render.cpp
+painter_render_glyph_index_INC := \
+	$(painter_common_INC)
+
+painter_benchmark_DEFS := \
+	$(painter_common_DEFS)
+painter_benchmark_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_benchmark.cpp
+painter_benchmark_INC := \
+	$(painter_common_INC)
+
+painter_animation_DEFS := \
+	$(painter_common_DEFS)
+painter_animation_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_animation.cpp
+painter_animation_INC := \
+	$(painter_common_INC)
+
+painter_flash_DEFS := \
+	$(painter_common_DEFS) \
+	-DFLASH_ENABLE \
+	-DEXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN=0 \
+	-DEXTERNAL_FLASH_SIZE=16384 \
+	-DQUANTUM_PAINTER_FLASH_DIRECTORY_ADDRESS=4096
+painter_flash_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/flash-assets.bin.c \
+	$(QUANTUM_PATH)/painter/tests/painter_flash.cpp
+painter_flash_INC := \
+	$(painter_common_INC) \
+	$(DRIVER_PATH)/flash
@@ -0,0 +1,7 @@
+TEST_LIST += \
+	painter_render \
+	painter_render_image_cache \
+	painter_render_glyph_index \
+	painter_animation \
+	painter_flash \
+	painter_benchmark
@@ -42,15 +42,116 @@
 report_mouse_t shared_mouse_report = {};
 uint16_t       shared_cpi          = 0;
 
+// Motion received from the other side that hasn't been reported yet
+static struct {
+    int16_t x;
+    int16_t y;
+    int16_t h;
+    int16_t v;
+    uint8_t buttons;
+} shared_motion = {};
+
+/**
+ * @brief adds two int16_t values, saturating instead of overflowing
+ *
+ * @param[in] total int16_t value
+ * @param[in] delta int16_t value
+ * @return int16_t saturated sum
+ */
+static inline int16_t pointing_device_saturating_add(int16_t total, int16_t delta) {
+    int32_t sum = (int32_t)total + delta;
+    if (sum < INT16_MIN) {
+        return INT16_MIN;
+    } else if (sum > INT16_MAX) {
+        return INT16_MAX;
+    } else {
+        return sum;
+    }
+}
+
+/**
+ * @brief clamps int16_t to int8_t
+ *
+ * @param[in] int16_t value
+ * @return int8_t clamped value
+ */
+static inline int8_t pointing_device_hv_clamp(int16_t value) {
+    if (value < INT8_MIN) {
+        return INT8_MIN;
+    } else if (value > INT8_MAX) {
+        return INT8_MAX;
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief clamps int16_t to int8_t
+ *
+ * @param[in] clamp_range_t value
+ * @return mouse_xy_report_t clamped value
+ */
+static inline mouse_xy_report_t pointing_device_xy_clamp(clamp_range_t value) {
+    if (value < XY_REPORT_MIN) {
+        return XY_REPORT_MIN;
+    } else if (value > XY_REPORT_MAX) {
+        return XY_REPORT_MAX;
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief Adds motion received from the other side to the shared mouse report
+ *
+ * Motion is accumulated until the next run of pointing device task, anything that doesn't fit into a single report is carried over to the following ones.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ *
+ * @param[in] x int16_t
+ * @param[in] y int16_t
+ * @param[in] h int8_t
+ * @param[in] v int8_t
+ * @param[in] buttons uint8_t current button state
+ */
+void pointing_device_add_shared_motion(int16_t x, int16_t y, int8_t h, int8_t v, uint8_t buttons) {
+    shared_motion.x       = pointing_device_saturating_add(shared_motion.x, x);
+    shared_motion.y       = pointing_device_saturating_add(shared_motion.y, y);
+    shared_motion.h       = pointing_device_saturating_add(shared_motion.h, h);
+    shared_motion.v       = pointing_device_saturating_add(shared_motion.v, v);
+    shared_motion.buttons = buttons;
+}
+
 /**
  * @brief Sets the shared mouse report used be pointing device task
  *
+ * Replaces any motion that hasn't been reported yet, use pointing_device_add_shared_motion() to add to it instead.
+ *
  * NOTE : Only available when using SPLIT_POINTING_ENABLE
  *
  * @param[in] new_mouse_report report_mouse_t
  */
 void pointing_device_set_shared_report(report_mouse_t new_mouse_report) {
-    shared_mouse_report = new_mouse_report;
+    shared_motion.x       = new_mouse_report.x;
+    shared_motion.y       = new_mouse_report.y;
+    shared_motion.h       = new_mouse_report.h;
+    shared_motion.v       = new_mouse_report.v;
+    shared_motion.buttons = new_mouse_report.buttons;
+}
+
+/**
+ * @brief Moves as much of the accumulated shared motion as fits into the shared mouse report
+ */
+static void pointing_device_take_shared_motion(void) {
+    shared_mouse_report.x       = pointing_device_xy_clamp(shared_motion.x);
+    shared_mouse_report.y       = pointing_device_xy_clamp(shared_motion.y);
+    shared_mouse_report.h       = pointing_device_hv_clamp(shared_motion.h);
+    shared_mouse_report.v       = pointing_device_hv_clamp(shared_motion.v);
+    shared_mouse_report.buttons = shared_motion.buttons;
+    shared_motion.x -= shared_mouse_report.x;
+    shared_motion.y -= shared_mouse_report.y;
+    shared_motion.h -= shared_mouse_report.h;
+    shared_motion.v -= shared_mouse_report.v;
 }
 
 /**
@@ -241,6 +342,10 @@ __attribute__((weak)) bool pointing_device_task(void) {
     last_exec = timer_read32();
 #endif
 
+#if defined(SPLIT_POINTING_ENABLE)
+    pointing_device_take_shared_motion();
+#endif
+
     // Gather report info
 #ifdef POINTING_DEVICE_MOTION_PIN
 #    if defined(SPLIT_POINTING_ENABLE)
@@ -376,37 +481,6 @@ void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
     }
 }
 
-/**
- * @brief clamps int16_t to int8_t
- *
- * @param[in] int16_t value
- * @return int8_t clamped value
- */
-static inline int8_t pointing_device_hv_clamp(int16_t value) {
-    if (value < INT8_MIN) {
-        return INT8_MIN;
-    } else if (value > INT8_MAX) {
-        return INT8_MAX;
-    } else {
-        return value;
-    }
-}
-
-/**
- * @brief clamps int16_t to int8_t
- *
- * @param[in] clamp_range_t value
- * @return mouse_xy_report_t clamped value
- */
-static inline mouse_xy_report_t pointing_device_xy_clamp(clamp_range_t value) {
-    if (value < XY_REPORT_MIN) {
-        return XY_REPORT_MIN;
-    } else if (value > XY_REPORT_MAX) {
-        return XY_REPORT_MAX;
-    } else {
-        return value;
-    }
-}
 /**
  * @brief combines 2 mouse reports and returns 2
  *
@@ -68,6 +68,10 @@
 #    include "process_unicode_common.h"
 #endif
 
+#ifdef EEPROM_WRITE_BACK_ENABLE
+#    include "eeprom_driver.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -193,6 +197,10 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #endif
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
+#endif
+    eeconfig_flush();
+#ifdef EEPROM_WRITE_BACK_ENABLE
+    eeprom_write_back_flush();
 #endif
 }
 
@@ -284,8 +292,11 @@ bool process_record_quantum(keyrecord_t *record) {
     }
 #endif
 
+    // Keycodes of subsystems which aren't initialized yet are ignored, see BOOT_DEFERRED_INIT
+    __attribute__((unused)) const bool init_complete = keyboard_init_complete();
+
 #ifdef RGBLIGHT_ENABLE
-    if (record->event.pressed) {
+    if (init_complete && record->event.pressed) {
         preprocess_rgblight();
     }
 #endif
@@ -309,16 +320,16 @@ bool process_record_quantum(keyrecord_t *record) {
             process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+            (!init_complete || process_clicky(keycode, record)) &&
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+            (!init_complete || process_haptic(keycode, record)) &&
 #endif
 #if defined(VIA_ENABLE)
             process_record_via(keycode, record) &&
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+            (!init_complete || process_auto_mouse(keycode, record)) &&
 #endif
             process_record_kb(keycode, record) &&
 #if defined(SECURE_ENABLE)
@@ -331,16 +342,16 @@ bool process_record_quantum(keyrecord_t *record) {
             process_midi(keycode, record) &&
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+            (!init_complete || process_audio(keycode, record)) &&
 #endif
 #if defined(BACKLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE)
-            process_backlight(keycode, record) &&
+            (!init_complete || process_backlight(keycode, record)) &&
 #endif
 #ifdef STENO_ENABLE
             process_steno(keycode, record) &&
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+            (!init_complete || process_music(keycode, record)) &&
 #endif
 #ifdef CAPS_WORD_ENABLE
             process_caps_word(keycode, record) &&
@@ -373,7 +384,7 @@ bool process_record_quantum(keyrecord_t *record) {
             process_grave_esc(keycode, record) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_rgb(keycode, record) &&
+            (!init_complete || process_rgb(keycode, record)) &&
 #endif
 #ifdef JOYSTICK_ENABLE
             process_joystick(keycode, record) &&
@@ -421,18 +432,18 @@ bool process_record_quantum(keyrecord_t *record) {
                 return false;
 #ifdef VELOCIKEY_ENABLE
             case QK_VELOCIKEY_TOGGLE:
-                velocikey_toggle();
+                if (init_complete) velocikey_toggle();
                 return false;
 #endif
 #ifdef BLUETOOTH_ENABLE
             case QK_OUTPUT_AUTO:
-                set_output(OUTPUT_AUTO);
+                if (init_complete) set_output(OUTPUT_AUTO);
                 return false;
             case QK_OUTPUT_USB:
-                set_output(OUTPUT_USB);
+                if (init_complete) set_output(OUTPUT_USB);
                 return false;
             case QK_OUTPUT_BLUETOOTH:
-                set_output(OUTPUT_BLUETOOTH);
+                if (init_complete) set_output(OUTPUT_BLUETOOTH);
                 return false;
 #endif
 #ifndef NO_ACTION_ONESHOT
@@ -504,6 +515,8 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 
 void suspend_power_down_quantum(void) {
     suspend_power_down_kb();
+    // Nothing else is going to change the configuration for a while
+    eeconfig_flush();
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
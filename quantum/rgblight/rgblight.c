@@ -180,7 +180,11 @@ void rgblight_check_config(void) {
 
 uint64_t eeconfig_read_rgblight(void) {
 #ifdef EEPROM_ENABLE
-    return (uint64_t)((eeprom_read_dword(EECONFIG_RGBLIGHT)) | ((uint64_t)eeprom_read_byte(EECONFIG_RGBLIGHT_EXTENDED) << 32));
+    uint32_t val;
+    uint8_t  extended;
+    eeconfig_read_record(EECONFIG_RECORD_RGBLIGHT, &val);
+    eeconfig_read_record(EECONFIG_RECORD_RGBLIGHT_EXTENDED, &extended);
+    return (uint64_t)val | ((uint64_t)extended << 32);
 #else
     return 0;
 #endif
@@ -189,8 +193,10 @@ uint64_t eeconfig_read_rgblight(void) {
 void eeconfig_update_rgblight(uint64_t val) {
 #ifdef EEPROM_ENABLE
     rgblight_check_config();
-    eeprom_update_dword(EECONFIG_RGBLIGHT, val & 0xFFFFFFFF);
-    eeprom_update_byte(EECONFIG_RGBLIGHT_EXTENDED, (val >> 32) & 0xFF);
+    uint32_t config   = val & 0xFFFFFFFF;
+    uint8_t  extended = (val >> 32) & 0xFF;
+    eeconfig_update_record_deferred(EECONFIG_RECORD_RGBLIGHT, &config);
+    eeconfig_update_record_deferred(EECONFIG_RECORD_RGBLIGHT_EXTENDED, &extended);
 #endif
 }
 
@@ -80,8 +80,7 @@ enum serial_transaction_id {
 #endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
-    GET_POINTING_CHECKSUM,
-    GET_POINTING_DATA,
+    GET_POINTING_MOTION,
     PUT_POINTING_CPI,
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -97,11 +96,13 @@ enum serial_transaction_id {
     PUT_ACTIVITY,
 #endif // SPLIT_ACTIVITY_ENABLE
 
+#if defined(SPLIT_STREAM_ENABLE)
+    PUT_STREAM_CHUNK,
+#endif // defined(SPLIT_STREAM_ENABLE)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     PUT_RPC_INFO,
-    PUT_RPC_REQ_DATA,
     EXECUTE_RPC,
-    GET_RPC_RESP_DATA,
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 // keyboard-specific
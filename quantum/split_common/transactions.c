@@ -64,6 +64,10 @@
 #    include "wpm.h"
 #endif
 
+#ifdef __AVR__
+#    include "atomic_util.h"
+#endif // __AVR__
+
 #define SYNC_TIMER_OFFSET 2
 
 #ifndef FORCED_SYNC_THROTTLE_MS
@@ -80,13 +84,21 @@
     { 0, 0, sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), cb }
 #define trans_target2initiator_initializer(member) trans_target2initiator_initializer_cb(member, NULL)
 
+#define trans_bidirectional_initializer_cb(initiator2target_member, target2initiator_member, cb) \
+    { sizeof_member(split_shared_memory_t, initiator2target_member), offsetof(split_shared_memory_t, initiator2target_member), sizeof_member(split_shared_memory_t, target2initiator_member), offsetof(split_shared_memory_t, target2initiator_member), cb }
+
 #define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
-void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
-void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+void        slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+void        slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+static void rpc_queue_process(void);
+
+#    define TRANSACTIONS_RPC_MASTER() rpc_queue_process()
+#else // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+#    define TRANSACTIONS_RPC_MASTER()
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 ////////////////////////////////////////////////////
@@ -139,6 +151,18 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+/**
+ * @brief Guards the slave's main loop while it modifies state that slave
+ * callbacks modify as well. On AVR, slave callbacks run from the I2C or serial
+ * interrupt, where `split_shared_memory_lock()` doesn't do anything -- so
+ * interrupts are disabled instead. Elsewhere, the lock already excludes them.
+ */
+#ifdef __AVR__
+#    define SLAVE_CALLBACK_ATOMIC_BLOCK ATOMIC_BLOCK_FORCEON
+#else
+#    define SLAVE_CALLBACK_ATOMIC_BLOCK
+#endif // __AVR__
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
@@ -684,6 +708,10 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
+static uint8_t pointing_motion_checksum(const split_pointing_motion_t *motion) {
+    return crc8(&motion->sequence, sizeof(*motion) - offsetof(split_pointing_motion_t, sequence));
+}
+
 static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
 #    if defined(POINTING_DEVICE_LEFT)
     if (is_keyboard_left()) {
@@ -694,14 +722,22 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
         return true;
     }
 #    endif
-    static uint32_t last_update = 0;
-    static uint16_t last_cpi    = 0;
-    report_mouse_t  temp_state;
-    uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
-    if (okay) pointing_device_set_shared_report(temp_state);
+    static uint8_t          last_sequence = 0;
+    static uint16_t         last_cpi      = 0;
+    split_pointing_ack_t    ack           = {.sequence = last_sequence, .inverse = ~last_sequence};
+    split_pointing_motion_t motion;
+    uint16_t                temp_cpi;
+
+    // Acknowledge the last packet, the slave answers with either the same one or its successor
+    bool okay = transport_execute_transaction(GET_POINTING_MOTION, &ack, sizeof(ack), &motion, sizeof(motion));
+    okay      = okay && motion.checksum == pointing_motion_checksum(&motion);
+    if (okay && motion.sequence != last_sequence) {
+        pointing_device_add_shared_motion(motion.x, motion.y, motion.h, motion.v, motion.buttons);
+        last_sequence = motion.sequence;
+    }
+
     temp_cpi = pointing_device_get_shared_cpi();
-    if (temp_cpi && last_cpi != temp_cpi) {
+    if (okay && temp_cpi && last_cpi != temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
         okay                      = transport_write(PUT_POINTING_CPI, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi));
         if (okay) {
@@ -713,16 +749,56 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
 
 extern const pointing_device_driver_t pointing_device_driver;
 
-static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-#    if defined(POINTING_DEVICE_LEFT)
-    if (!is_keyboard_left()) {
-        return;
+// Motion read on the slave that hasn't been packed for the master yet, guarded by the shared memory lock
+static struct {
+    int16_t x;
+    int16_t y;
+    int16_t h;
+    int16_t v;
+    uint8_t buttons;
+} pointing_pending;
+
+static int16_t pointing_saturating_add(int16_t total, int16_t delta) {
+    int32_t sum = (int32_t)total + delta;
+    return sum < INT16_MIN ? INT16_MIN : (sum > INT16_MAX ? INT16_MAX : sum);
+}
+
+static int8_t pointing_take_hv(int16_t *pending) {
+    int8_t value = *pending < INT8_MIN ? INT8_MIN : (*pending > INT8_MAX ? INT8_MAX : *pending);
+    *pending -= value;
+    return value;
+}
+
+static void slave_pointing_motion_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_pointing_ack_t *ack    = (const split_pointing_ack_t *)initiator2target_buffer;
+    split_pointing_motion_t    *motion = (split_pointing_motion_t *)target2initiator_buffer;
+
+    if (motion->checksum != pointing_motion_checksum(motion)) {
+        // Nothing was sent since booting, carry on from the last packet the master received
+        memset(motion, 0, sizeof(split_pointing_motion_t));
+        motion->sequence = ack->sequence;
+        motion->checksum = pointing_motion_checksum(motion);
     }
-#    elif defined(POINTING_DEVICE_RIGHT)
-    if (is_keyboard_left()) {
-        return;
+
+    // Only move on to the next packet once the master confirmed the current one, otherwise it is sent again
+    bool consumed = ack->sequence == (uint8_t)~ack->inverse && ack->sequence == motion->sequence;
+    bool pending  = pointing_pending.x || pointing_pending.y || pointing_pending.h || pointing_pending.v || pointing_pending.buttons != motion->buttons;
+
+    if (consumed && pending) {
+        motion->sequence++;
+        motion->buttons  = pointing_pending.buttons;
+        motion->x        = pointing_pending.x;
+        motion->y        = pointing_pending.y;
+        motion->h        = pointing_take_hv(&pointing_pending.h);
+        motion->v        = pointing_take_hv(&pointing_pending.v);
+        motion->checksum = pointing_motion_checksum(motion);
+
+        pointing_pending.x = 0;
+        pointing_pending.y = 0;
     }
-#    endif
+}
+
+void split_pointing_slave_task(void) {
 #    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
@@ -733,27 +809,47 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 
     uint16_t temp_cpi = !pointing_device_driver.get_cpi ? 0 : pointing_device_driver.get_cpi(); // check for NULL
 
+    uint16_t cpi;
     split_shared_memory_lock();
-    split_slave_pointing_sync_t pointing;
-    memcpy(&pointing, &split_shmem->pointing, sizeof(split_slave_pointing_sync_t));
+    SLAVE_CALLBACK_ATOMIC_BLOCK {
+        cpi = split_shmem->pointing.cpi;
+    }
     split_shared_memory_unlock();
 
-    if (pointing.cpi && pointing.cpi != temp_cpi && pointing_device_driver.set_cpi) {
-        pointing_device_driver.set_cpi(pointing.cpi);
+    if (cpi && cpi != temp_cpi && pointing_device_driver.set_cpi) {
+        pointing_device_driver.set_cpi(cpi);
     }
 
-    pointing.report = pointing_device_driver.get_report((report_mouse_t){0});
-    // Now update the checksum given that the pointing has been written to
-    pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
+    report_mouse_t report = pointing_device_driver.get_report((report_mouse_t){0});
 
+    // Motion is accumulated at the sensor rate, until the master picks it up
     split_shared_memory_lock();
-    memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
+    SLAVE_CALLBACK_ATOMIC_BLOCK {
+        pointing_pending.x       = pointing_saturating_add(pointing_pending.x, report.x);
+        pointing_pending.y       = pointing_saturating_add(pointing_pending.y, report.y);
+        pointing_pending.h       = pointing_saturating_add(pointing_pending.h, report.h);
+        pointing_pending.v       = pointing_saturating_add(pointing_pending.v, report.v);
+        pointing_pending.buttons = report.buttons;
+    }
     split_shared_memory_unlock();
 }
 
+static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#    if defined(POINTING_DEVICE_LEFT)
+    if (!is_keyboard_left()) {
+        return;
+    }
+#    elif defined(POINTING_DEVICE_RIGHT)
+    if (is_keyboard_left()) {
+        return;
+    }
+#    endif
+    split_pointing_slave_task();
+}
+
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
-#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_MOTION] = trans_bidirectional_initializer_cb(pointing.ack, pointing.motion, slave_pointing_motion_callback), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -892,6 +988,170 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Bulk streaming
+
+#if defined(SPLIT_STREAM_ENABLE)
+
+_Static_assert(SPLIT_STREAM_CHUNK_SIZE > 0 && SPLIT_STREAM_CHUNK_SIZE <= UINT8_MAX - offsetof(split_stream_chunk_t, data), "SPLIT_STREAM_CHUNK_SIZE out of range");
+_Static_assert(SPLIT_STREAM_BUFFER_CHUNKS > 0 && SPLIT_STREAM_BUFFER_CHUNKS <= UINT8_MAX, "SPLIT_STREAM_BUFFER_CHUNKS out of range");
+
+void slave_stream_chunk_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+
+// Master side: the transfer in progress, the data is read in place
+static const uint8_t *stream_tx_data        = NULL;
+static uint32_t       stream_tx_length      = 0;
+static uint32_t       stream_tx_offset      = 0; // acknowledged by the slave
+static uint8_t        stream_tx_channel     = 0;
+static uint8_t        stream_tx_transfer_id = 0;
+static bool           stream_tx_active      = false;
+
+// Slave side: chunks received ahead of being handed over by the main loop
+static split_stream_chunk_t stream_rx_chunks[SPLIT_STREAM_BUFFER_CHUNKS];
+static uint8_t              stream_rx_head        = 0;
+static uint8_t              stream_rx_count       = 0;
+static uint8_t              stream_rx_transfer_id = 0;
+static uint32_t             stream_rx_offset      = 0;
+
+__attribute__((weak)) bool split_stream_receive_user(uint8_t channel, uint32_t offset, uint32_t total_length, const uint8_t *data, uint8_t length) {
+    return true;
+}
+
+__attribute__((weak)) bool split_stream_receive_kb(uint8_t channel, uint32_t offset, uint32_t total_length, const uint8_t *data, uint8_t length) {
+    return split_stream_receive_user(channel, offset, total_length, data, length);
+}
+
+bool split_stream_send(uint8_t channel, const void *data, uint32_t length) {
+    if (stream_tx_active || !is_transport_connected() || !data || !length) {
+        return false;
+    }
+
+    stream_tx_data    = (const uint8_t *)data;
+    stream_tx_length  = length;
+    stream_tx_offset  = 0;
+    stream_tx_channel = channel;
+    stream_tx_transfer_id++;
+    stream_tx_active = true;
+    return true;
+}
+
+bool is_split_stream_busy(void) {
+    return stream_tx_active;
+}
+
+void split_stream_abort(void) {
+    stream_tx_active = false;
+}
+
+static bool stream_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    for (uint8_t i = 0; stream_tx_active && i < SPLIT_STREAM_CHUNKS_PER_SCAN; i++) {
+        uint32_t             remaining = stream_tx_length - stream_tx_offset;
+        split_stream_chunk_t chunk     = {
+            .transfer_id  = stream_tx_transfer_id,
+            .channel      = stream_tx_channel,
+            .length       = remaining < SPLIT_STREAM_CHUNK_SIZE ? remaining : SPLIT_STREAM_CHUNK_SIZE,
+            .offset       = stream_tx_offset,
+            .total_length = stream_tx_length,
+        };
+        memcpy(chunk.data, &stream_tx_data[stream_tx_offset], chunk.length);
+        chunk.checksum = crc8(&chunk.transfer_id, sizeof(chunk) - offsetof(split_stream_chunk_t, transfer_id));
+
+        split_stream_ack_t ack;
+        if (!transport_execute_transaction(PUT_STREAM_CHUNK, &chunk, sizeof(chunk), &ack, sizeof(ack))) {
+            return false;
+        }
+        if (ack.checksum != crc8(&ack.transfer_id, sizeof(ack) - offsetof(split_stream_ack_t, transfer_id))) {
+            return false;
+        }
+
+        if (ack.transfer_id != stream_tx_transfer_id || ack.offset > chunk.offset + chunk.length) {
+            // The slave lost track of this transfer, e.g. because either half was reset, so start over under a new ID
+            stream_tx_offset = 0;
+            stream_tx_transfer_id++;
+        } else if (ack.offset > stream_tx_offset) {
+            stream_tx_offset = ack.offset;
+        }
+
+        if (stream_tx_offset == stream_tx_length) {
+            stream_tx_active = false;
+        }
+        // Leave the slave some time to catch up
+        if (ack.free_chunks == 0) {
+            break;
+        }
+    }
+    return true;
+}
+
+void slave_stream_chunk_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_stream_chunk_t *chunk = &split_shmem->stream_chunk;
+    split_stream_ack_t         *ack   = &split_shmem->stream_ack;
+
+    if (chunk->checksum == crc8(&chunk->transfer_id, sizeof(*chunk) - offsetof(split_stream_chunk_t, transfer_id)) && chunk->length <= SPLIT_STREAM_CHUNK_SIZE) {
+        // The first chunk of a new transfer (re)starts receiving
+        if (chunk->offset == 0 && chunk->transfer_id != stream_rx_transfer_id) {
+            stream_rx_transfer_id = chunk->transfer_id;
+            stream_rx_offset      = 0;
+        }
+        // Anything else has to continue right where the transfer left off. Duplicates, sent again because their ack
+        // got lost, are acknowledged again without being appended
+        if (chunk->transfer_id == stream_rx_transfer_id && chunk->offset == stream_rx_offset && stream_rx_count < SPLIT_STREAM_BUFFER_CHUNKS) {
+            memcpy(&stream_rx_chunks[(stream_rx_head + stream_rx_count) % SPLIT_STREAM_BUFFER_CHUNKS], chunk, sizeof(*chunk));
+            stream_rx_count++;
+            stream_rx_offset += chunk->length;
+        }
+    }
+
+    ack->transfer_id = stream_rx_transfer_id;
+    ack->free_chunks = SPLIT_STREAM_BUFFER_CHUNKS - stream_rx_count;
+    ack->reserved    = 0;
+    ack->offset      = stream_rx_offset;
+    ack->checksum    = crc8(&ack->transfer_id, sizeof(*ack) - offsetof(split_stream_ack_t, transfer_id));
+}
+
+void split_stream_slave_task(void) {
+    split_stream_chunk_t chunk;
+    while (true) {
+        bool available;
+        split_shared_memory_lock();
+        SLAVE_CALLBACK_ATOMIC_BLOCK {
+            available = stream_rx_count > 0;
+            if (available) {
+                memcpy(&chunk, &stream_rx_chunks[stream_rx_head], sizeof(chunk));
+            }
+        }
+        split_shared_memory_unlock();
+
+        // Keep the chunk buffered if the receiver isn't ready for it yet, which holds back the master
+        if (!available || !split_stream_receive_kb(chunk.channel, chunk.offset, chunk.total_length, chunk.data, chunk.length)) {
+            return;
+        }
+
+        split_shared_memory_lock();
+        SLAVE_CALLBACK_ATOMIC_BLOCK {
+            stream_rx_head = (stream_rx_head + 1) % SPLIT_STREAM_BUFFER_CHUNKS;
+            stream_rx_count--;
+        }
+        split_shared_memory_unlock();
+    }
+}
+
+static void stream_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_stream_slave_task();
+}
+
+#    define TRANSACTIONS_STREAM_MASTER() TRANSACTION_HANDLER_MASTER(stream)
+#    define TRANSACTIONS_STREAM_SLAVE() TRANSACTION_HANDLER_SLAVE(stream)
+#    define TRANSACTIONS_STREAM_REGISTRATIONS [PUT_STREAM_CHUNK] = trans_bidirectional_initializer_cb(stream_chunk, stream_ack, slave_stream_chunk_callback),
+
+#else // defined(SPLIT_STREAM_ENABLE)
+
+#    define TRANSACTIONS_STREAM_MASTER()
+#    define TRANSACTIONS_STREAM_SLAVE()
+#    define TRANSACTIONS_STREAM_REGISTRATIONS
+
+#endif // defined(SPLIT_STREAM_ENABLE)
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -922,17 +1182,17 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_STREAM_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
-        [PUT_RPC_INFO]  = trans_initiator2target_initializer_cb(rpc_info, slave_rpc_info_callback),
-    [PUT_RPC_REQ_DATA]  = trans_initiator2target_initializer(rpc_m2s_buffer),
-    [EXECUTE_RPC]       = trans_initiator2target_initializer_cb(rpc_info.payload.transaction_id, slave_rpc_exec_callback),
-    [GET_RPC_RESP_DATA] = trans_target2initiator_initializer(rpc_s2m_buffer),
+        [PUT_RPC_INFO] = trans_initiator2target_initializer_cb(rpc_info, slave_rpc_info_callback),
+    [EXECUTE_RPC]      = trans_bidirectional_initializer_cb(rpc_m2s_buffer, rpc_s2m_buffer, slave_rpc_exec_callback),
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_RPC_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -952,6 +1212,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_STREAM_MASTER();
     return true;
 }
 
@@ -975,83 +1236,358 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_STREAM_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+_Static_assert(RPC_M2S_FRAME_SIZE >= RPC_M2S_BUFFER_SIZE + sizeof(rpc_request_header_t), "RPC_M2S_FRAME_SIZE too small for RPC_M2S_BUFFER_SIZE");
+_Static_assert(RPC_S2M_FRAME_SIZE >= RPC_S2M_BUFFER_SIZE + sizeof(rpc_response_header_t) + 1, "RPC_S2M_FRAME_SIZE too small for RPC_S2M_BUFFER_SIZE");
+_Static_assert(RPC_M2S_FRAME_SIZE <= UINT8_MAX && RPC_S2M_FRAME_SIZE <= UINT8_MAX, "RPC frames exceed the maximum transaction size");
+_Static_assert(RPC_QUEUE_SIZE > 0 && RPC_QUEUE_SIZE <= INT8_MAX, "RPC_QUEUE_SIZE out of range");
+
+typedef struct _rpc_queue_entry_t {
+    rpc_request_header_t       header;
+    uint8_t                    attempts;
+    transaction_rpc_callback_t callback;
+    void                      *context;
+    uint8_t                    m2s_buffer[RPC_M2S_BUFFER_SIZE];
+} rpc_queue_entry_t;
+
+static rpc_queue_entry_t rpc_queue[RPC_QUEUE_SIZE];
+static uint8_t           rpc_queue_head      = 0;
+static uint8_t           rpc_queue_count     = 0;
+static uint8_t           rpc_next_request_id = 0;
+static bool              rpc_queue_busy      = false;
+static bool              rpc_session_started = false;
+
+// The slave keeps track of the highest request ID it executed, along with the responses of the last frame. A frame that
+// is retransmitted because its response got lost, possibly with more requests appended, can then be answered without
+// executing any of its requests twice.
+static bool    rpc_executed_valid        = false;
+static uint8_t rpc_executed_id           = 0;
+static uint8_t rpc_response_cache_length = 0;
+static uint8_t rpc_response_cache[RPC_S2M_FRAME_SIZE];
+
+#define rpc_queue_entry(index) (&rpc_queue[(rpc_queue_head + (index)) % RPC_QUEUE_SIZE])
+
+// Requests and responses are packed back to back within the frames, so they are handed to the callbacks through
+// word-aligned scratch buffers. This keeps casting the buffers to structs safe on MCUs without unaligned access.
+static uint32_t rpc_m2s_scratch[(RPC_M2S_BUFFER_SIZE + 3) / 4];
+static uint32_t rpc_s2m_scratch[(RPC_S2M_BUFFER_SIZE + 3) / 4];
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback) {
     // Prevent invoking RPC on QMK core sync data
-    if (transaction_id <= GET_RPC_RESP_DATA) return;
+    if (transaction_id <= EXECUTE_RPC) return;
 
     // Set the callback
-    split_transaction_table[transaction_id].slave_callback          = callback;
-    split_transaction_table[transaction_id].initiator2target_offset = offsetof(split_shared_memory_t, rpc_m2s_buffer);
-    split_transaction_table[transaction_id].target2initiator_offset = offsetof(split_shared_memory_t, rpc_s2m_buffer);
+    split_transaction_table[transaction_id].slave_callback = callback;
 }
 
-bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+/**
+ * @brief Remove the oldest request from the queue and report its outcome. The
+ * request is removed first, so that the callback is free to queue new ones.
+ */
+static void rpc_queue_complete(bool success, uint8_t target2initiator_buffer_size, const void *target2initiator_buffer) {
+    rpc_queue_entry_t         *entry          = rpc_queue_entry(0);
+    transaction_rpc_callback_t callback       = entry->callback;
+    void                      *context        = entry->context;
+    int8_t                     transaction_id = entry->header.transaction_id;
+
+    rpc_queue_head = (rpc_queue_head + 1) % RPC_QUEUE_SIZE;
+    rpc_queue_count--;
+
+    if (callback) {
+        callback(transaction_id, success, target2initiator_buffer_size, target2initiator_buffer, context);
+    }
+}
+
+/**
+ * @brief Tell the slave that the master booted. Request IDs start over, so the
+ * slave has to forget about the requests it executed before.
+ */
+static bool rpc_start_session(void) {
+    rpc_sync_info_t info = {.payload = {.reset = true}};
+    info.checksum        = crc8(&info.payload, sizeof(info.payload));
+
+    rpc_session_started = transport_write(PUT_RPC_INFO, &info, sizeof(info));
+    return rpc_session_started;
+}
+
+/**
+ * @brief Send the oldest queued requests to the slave within a single frame.
+ *
+ * The request frame is announced through PUT_RPC_INFO, after which EXECUTE_RPC
+ * transfers the requests, executes them on the slave and retrieves all of
+ * their responses at once.
+ *
+ * @return true if the frame was executed successfully.
+ */
+static bool rpc_queue_send_frame(void) {
+    if (rpc_queue_count == 0) {
+        return true;
+    }
+
+    rpc_queue_busy = true;
+
+    // Requests can't be delivered while transport is disconnected
+    if (!is_transport_connected()) {
+        while (rpc_queue_count) {
+            rpc_queue_complete(false, 0, NULL);
+        }
+        rpc_queue_busy = false;
+        return false;
+    }
+
+    // Pack as many requests as fit into the frames, keeping them in order
+    uint8_t request[RPC_M2S_FRAME_SIZE];
+    uint8_t response[RPC_S2M_FRAME_SIZE];
+    uint8_t m2s_length = 0;
+    uint8_t s2m_length = 1; // leading checksum
+    uint8_t batch      = 0;
+    while (batch < rpc_queue_count) {
+        rpc_queue_entry_t *entry    = rpc_queue_entry(batch);
+        uint8_t            m2s_size = sizeof(rpc_request_header_t) + entry->header.m2s_length;
+        uint8_t            s2m_size = sizeof(rpc_response_header_t) + entry->header.s2m_length;
+        if (m2s_length + m2s_size > RPC_M2S_FRAME_SIZE || s2m_length + s2m_size > RPC_S2M_FRAME_SIZE) {
+            break;
+        }
+        memcpy(&request[m2s_length], &entry->header, sizeof(rpc_request_header_t));
+        memcpy(&request[m2s_length + sizeof(rpc_request_header_t)], entry->m2s_buffer, entry->header.m2s_length);
+        m2s_length += m2s_size;
+        s2m_length += s2m_size;
+        batch++;
+    }
+
+    // Prepare the metadata block
+    rpc_sync_info_t info = {.payload = {.m2s_length = m2s_length, .s2m_length = s2m_length, .m2s_checksum = crc8(request, m2s_length)}};
+    info.checksum        = crc8(&info.payload, sizeof(info.payload));
+
+    // Make sure the local side knows that we're not sending the full frames
+    split_transaction_table[EXECUTE_RPC].initiator2target_buffer_size = m2s_length;
+    split_transaction_table[EXECUTE_RPC].target2initiator_buffer_size = s2m_length;
+
+    bool okay = rpc_session_started || rpc_start_session();
+    okay      = okay && transport_write(PUT_RPC_INFO, &info, sizeof(info));
+    okay      = okay && transport_execute_transaction(EXECUTE_RPC, request, m2s_length, response, s2m_length);
+    okay      = okay && response[0] == crc8(&response[1], s2m_length - 1);
+
+    // Responses have to answer the requests in order
+    uint8_t offset = 1;
+    for (uint8_t i = 0; okay && i < batch; i++) {
+        rpc_response_header_t header;
+        memcpy(&header, &response[offset], sizeof(header));
+        okay = header.request_id == rpc_queue_entry(i)->header.request_id && header.s2m_length == rpc_queue_entry(i)->header.s2m_length;
+        offset += sizeof(header) + header.s2m_length;
+    }
+
+    if (okay) {
+        offset = 1;
+        for (uint8_t i = 0; i < batch; i++) {
+            uint8_t length = rpc_queue_entry(0)->header.s2m_length;
+            memcpy(rpc_s2m_scratch, &response[offset + sizeof(rpc_response_header_t)], length);
+            offset += sizeof(rpc_response_header_t) + length;
+            rpc_queue_complete(true, length, rpc_s2m_scratch);
+        }
+    } else {
+        // Leave the requests queued for a retry, unless they ran out of attempts
+        for (uint8_t i = 0; i < batch; i++) {
+            rpc_queue_entry(i)->attempts++;
+        }
+        while (rpc_queue_count && rpc_queue_entry(0)->attempts >= RPC_MAX_ATTEMPTS) {
+            rpc_queue_complete(false, 0, NULL);
+        }
+    }
+
+    rpc_queue_busy = false;
+    return okay;
+}
+
+static void rpc_queue_process(void) {
+    // Drain the queue, but leave the remaining requests for the next scan once a frame failed.
+    // This runs ahead of the other transactions, so that queued requests are failed once the
+    // slave is considered disconnected, instead of waiting for it to come back.
+    // The session is started right away, so that it doesn't cost the first frame an extra transaction.
+    if (!rpc_session_started && is_transport_connected()) {
+        rpc_start_session();
+    }
+    for (uint8_t frames = 0; frames < RPC_QUEUE_SIZE && rpc_queue_count; frames++) {
+        if (!rpc_queue_send_frame()) {
+            break;
+        }
+    }
+}
+
+bool transaction_rpc_exec_async(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, transaction_rpc_callback_t callback, void *context) {
     // Prevent transaction attempts while transport is disconnected
     if (!is_transport_connected()) {
         return false;
     }
     // Prevent invoking RPC on QMK core sync data
-    if (transaction_id <= GET_RPC_RESP_DATA) return false;
+    if (transaction_id <= EXECUTE_RPC || transaction_id >= NUM_TOTAL_TRANSACTIONS) return false;
     // Prevent sizing issues
     if (initiator2target_buffer_size > RPC_M2S_BUFFER_SIZE) return false;
     if (target2initiator_buffer_size > RPC_S2M_BUFFER_SIZE) return false;
+    // Prevent overflowing the queue
+    if (rpc_queue_count >= RPC_QUEUE_SIZE) return false;
+
+    rpc_queue_entry_t *entry = rpc_queue_entry(rpc_queue_count);
+    entry->header            = (rpc_request_header_t){.request_id = rpc_next_request_id++, .transaction_id = transaction_id, .m2s_length = initiator2target_buffer_size, .s2m_length = target2initiator_buffer_size};
+    entry->attempts          = 0;
+    entry->callback          = callback;
+    entry->context           = context;
+    if (initiator2target_buffer_size) {
+        memcpy(entry->m2s_buffer, initiator2target_buffer, initiator2target_buffer_size);
+    }
+    rpc_queue_count++;
+    return true;
+}
 
-    // Prepare the metadata block
-    rpc_sync_info_t info = {.payload = {.transaction_id = transaction_id, .m2s_length = initiator2target_buffer_size, .s2m_length = target2initiator_buffer_size}};
-    info.checksum        = crc8(&info.payload, sizeof(info.payload));
-
-    // Make sure the local side knows that we're not sending the full block of data
-    split_transaction_table[PUT_RPC_REQ_DATA].initiator2target_buffer_size  = initiator2target_buffer_size;
-    split_transaction_table[GET_RPC_RESP_DATA].target2initiator_buffer_size = target2initiator_buffer_size;
+typedef struct _rpc_sync_result_t {
+    void *buffer;
+    bool  done;
+    bool  success;
+} rpc_sync_result_t;
 
-    // Run through the sequence:
-    // * set the transaction ID and lengths
-    // * send the request data
-    // * execute RPC callback
-    // * retrieve the response data
-    if (!transport_write(PUT_RPC_INFO, &info, sizeof(info))) {
-        return false;
+static void rpc_sync_callback(int8_t transaction_id, bool success, uint8_t target2initiator_buffer_size, const void *target2initiator_buffer, void *context) {
+    rpc_sync_result_t *result = (rpc_sync_result_t *)context;
+    if (success && target2initiator_buffer_size) {
+        memcpy(result->buffer, target2initiator_buffer, target2initiator_buffer_size);
     }
-    if (!transport_write(PUT_RPC_REQ_DATA, initiator2target_buffer, initiator2target_buffer_size)) {
-        return false;
+    result->success = success;
+    result->done    = true;
+}
+
+bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    // The shared frames are in use while completion callbacks run
+    if (rpc_queue_busy) return false;
+
+    // Make room for the request, it is then sent along with whatever else is queued
+    if (rpc_queue_count >= RPC_QUEUE_SIZE) {
+        rpc_queue_send_frame();
     }
-    if (!transport_write(EXECUTE_RPC, &transaction_id, sizeof(transaction_id))) {
+
+    rpc_sync_result_t result = {.buffer = target2initiator_buffer, .done = false, .success = false};
+    if (!transaction_rpc_exec_async(transaction_id, initiator2target_buffer_size, initiator2target_buffer, target2initiator_buffer_size, rpc_sync_callback, &result)) {
         return false;
     }
-    if (!transport_read(GET_RPC_RESP_DATA, target2initiator_buffer, target2initiator_buffer_size)) {
-        return false;
+    while (!result.done) {
+        rpc_queue_send_frame();
     }
-    return true;
+    return result.success;
 }
 
 void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
-    // The RPC info block contains the intended transaction ID, as well as the sizes for both inbound and outbound data.
+    // The RPC info block contains the sizes of both the request and the response frame.
     // Ignore the args -- the `split_shmem` already has the info, we just need to act upon it.
     // We must keep the `split_transaction_table` non-const, so that it is able to be modified at runtime.
+    if (crc8(&split_shmem->rpc_info.payload, sizeof(split_shmem->rpc_info.payload)) != split_shmem->rpc_info.checksum) {
+        return;
+    }
+    if (split_shmem->rpc_info.payload.reset) {
+        rpc_executed_valid        = false;
+        rpc_response_cache_length = 0;
+        return;
+    }
+    if (split_shmem->rpc_info.payload.m2s_length > RPC_M2S_FRAME_SIZE || split_shmem->rpc_info.payload.s2m_length > RPC_S2M_FRAME_SIZE) {
+        return;
+    }
+
+    split_transaction_table[EXECUTE_RPC].initiator2target_buffer_size = split_shmem->rpc_info.payload.m2s_length;
+    split_transaction_table[EXECUTE_RPC].target2initiator_buffer_size = split_shmem->rpc_info.payload.s2m_length;
+}
+
+static bool rpc_request_executed(uint8_t request_id) {
+    // Only the requests still queued on the master can be sent again, so IDs never fall further behind than RPC_QUEUE_SIZE
+    return rpc_executed_valid && (int8_t)(request_id - rpc_executed_id) <= 0;
+}
 
-    split_transaction_table[PUT_RPC_REQ_DATA].initiator2target_buffer_size  = split_shmem->rpc_info.payload.m2s_length;
-    split_transaction_table[GET_RPC_RESP_DATA].target2initiator_buffer_size = split_shmem->rpc_info.payload.s2m_length;
+static const uint8_t *rpc_cached_response(uint8_t request_id, uint8_t s2m_length) {
+    uint8_t offset = 0;
+    while (offset + sizeof(rpc_response_header_t) <= rpc_response_cache_length) {
+        rpc_response_header_t header;
+        memcpy(&header, &rpc_response_cache[offset], sizeof(header));
+        if (header.request_id == request_id && header.s2m_length == s2m_length) {
+            return &rpc_response_cache[offset + sizeof(header)];
+        }
+        offset += sizeof(header) + header.s2m_length;
+    }
+    return NULL;
 }
 
 void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const uint8_t *request    = split_shmem->rpc_m2s_buffer;
+    uint8_t       *response   = split_shmem->rpc_s2m_buffer;
+    uint8_t        m2s_length = split_shmem->rpc_info.payload.m2s_length;
+    uint8_t        s2m_length = split_shmem->rpc_info.payload.s2m_length;
+
     // We can assume that the buffer lengths are correctly set, now, given that sequentially the rpc_info callback was already executed.
-    // Go through the rpc_info and execute _that_ transaction's callback, with the scratch buffers as inputs.
-    // As a safety precaution we check that the received payload matches its checksum first.
+    // As a safety precaution we check that the received info and frame match their checksums first.
     if (crc8(&split_shmem->rpc_info.payload, sizeof(split_shmem->rpc_info.payload)) != split_shmem->rpc_info.checksum) {
         return;
     }
+    if (m2s_length < sizeof(rpc_request_header_t) || m2s_length > RPC_M2S_FRAME_SIZE || s2m_length > RPC_S2M_FRAME_SIZE) {
+        return;
+    }
+    if (crc8(request, m2s_length) != split_shmem->rpc_info.payload.m2s_checksum) {
+        return;
+    }
 
-    int8_t transaction_id = split_shmem->rpc_info.payload.transaction_id;
-    if (transaction_id < NUM_TOTAL_TRANSACTIONS) {
-        split_transaction_desc_t *trans = &split_transaction_table[transaction_id];
-        if (trans->slave_callback) {
-            trans->slave_callback(split_shmem->rpc_info.payload.m2s_length, split_shmem->rpc_m2s_buffer, split_shmem->rpc_info.payload.s2m_length, split_shmem->rpc_s2m_buffer);
+    // Check the whole frame before executing anything, so that either all of its requests are handled or none of them.
+    // Requests that were executed before have to be answered from the cache, as they must not be executed twice.
+    uint16_t m2s_offset = 0;
+    uint16_t s2m_offset = 1;
+    while (m2s_offset + sizeof(rpc_request_header_t) <= m2s_length) {
+        rpc_request_header_t header;
+        memcpy(&header, &request[m2s_offset], sizeof(header));
+        m2s_offset += sizeof(header) + header.m2s_length;
+        s2m_offset += sizeof(rpc_response_header_t) + header.s2m_length;
+
+        if (header.m2s_length > RPC_M2S_BUFFER_SIZE || header.s2m_length > RPC_S2M_BUFFER_SIZE) {
+            return;
+        }
+        if (m2s_offset > m2s_length || s2m_offset > s2m_length) {
+            return;
+        }
+        if (rpc_request_executed(header.request_id) && !rpc_cached_response(header.request_id, header.s2m_length)) {
+            return;
         }
     }
+
+    // Go through the requests and execute _their_ transaction's callbacks, appending the responses in the same order.
+    m2s_offset = 0;
+    s2m_offset = 1;
+    while (m2s_offset + sizeof(rpc_request_header_t) <= m2s_length) {
+        rpc_request_header_t header;
+        memcpy(&header, &request[m2s_offset], sizeof(header));
+        m2s_offset += sizeof(header);
+
+        if (rpc_request_executed(header.request_id)) {
+            memcpy(rpc_s2m_scratch, rpc_cached_response(header.request_id, header.s2m_length), header.s2m_length);
+        } else {
+            memcpy(rpc_m2s_scratch, &request[m2s_offset], header.m2s_length);
+            memset(rpc_s2m_scratch, 0, header.s2m_length);
+            if (header.transaction_id > EXECUTE_RPC && header.transaction_id < NUM_TOTAL_TRANSACTIONS) {
+                split_transaction_desc_t *trans = &split_transaction_table[header.transaction_id];
+                if (trans->slave_callback) {
+                    trans->slave_callback(header.m2s_length, rpc_m2s_scratch, header.s2m_length, rpc_s2m_scratch);
+                }
+            }
+            rpc_executed_valid = true;
+            rpc_executed_id    = header.request_id;
+        }
+        m2s_offset += header.m2s_length;
+
+        rpc_response_header_t response_header = {.request_id = header.request_id, .s2m_length = header.s2m_length};
+        memcpy(&response[s2m_offset], &response_header, sizeof(response_header));
+        memcpy(&response[s2m_offset + sizeof(response_header)], rpc_s2m_scratch, header.s2m_length);
+        s2m_offset += sizeof(response_header) + header.s2m_length;
+    }
+
+    response[0] = crc8(&response[1], s2m_offset - 1);
+
+    rpc_response_cache_length = s2m_offset - 1;
+    memcpy(rpc_response_cache, &response[1], rpc_response_cache_length);
 }
 
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -45,9 +45,63 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+typedef void (*transaction_rpc_callback_t)(int8_t transaction_id, bool success, uint8_t target2initiator_buffer_size, const void *target2initiator_buffer, void *context);
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 
+/**
+ * @brief Queue an RPC request without waiting for its response.
+ *
+ * The request data is copied, queued requests are sent during the next split
+ * transport update, packed together into as few frames as possible. Once the
+ * slave answered, or the request ran out of attempts, `callback` is invoked
+ * with the response.
+ *
+ * @return false if the request couldn't be queued.
+ */
+bool transaction_rpc_exec_async(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, transaction_rpc_callback_t callback, void *context);
+
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
 #define transaction_rpc_recv(transaction_id, target2initiator_buffer_size, target2initiator_buffer) transaction_rpc_exec(transaction_id, 0, NULL, target2initiator_buffer_size, target2initiator_buffer)
+#define transaction_rpc_send_async(transaction_id, initiator2target_buffer_size, initiator2target_buffer, callback, context) transaction_rpc_exec_async(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, callback, context)
+
+#if defined(SPLIT_STREAM_ENABLE)
+/**
+ * @brief Start streaming a buffer to the slave.
+ *
+ * The data is sent in the background, one chunk of `SPLIT_STREAM_CHUNK_SIZE`
+ * bytes after all other transactions of a split transport update, and is read
+ * in place, so it has to stay valid until the transfer completed.
+ *
+ * @return false if another transfer is still in progress.
+ */
+bool split_stream_send(uint8_t channel, const void *data, uint32_t length);
+
+bool is_split_stream_busy(void);
+void split_stream_abort(void);
+
+/**
+ * @brief Hand received chunks over to the slave side receiver, called from
+ * the slave's split transport update.
+ */
+void split_stream_slave_task(void);
+
+/**
+ * @brief Called on the slave for every chunk, in order.
+ *
+ * @return false if the chunk can't be processed yet, it is then offered again
+ * on the next update, and the master holds back once the buffer filled up.
+ */
+bool split_stream_receive_kb(uint8_t channel, uint32_t offset, uint32_t total_length, const uint8_t *data, uint8_t length);
+bool split_stream_receive_user(uint8_t channel, uint32_t offset, uint32_t total_length, const uint8_t *data, uint8_t length);
+#endif // defined(SPLIT_STREAM_ENABLE)
+
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+/**
+ * @brief Poll the slave's pointing device and accumulate its motion until the
+ * master fetches it, called from the slave's split transport update.
+ */
+void split_pointing_slave_task(void);
+#endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
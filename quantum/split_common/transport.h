@@ -31,6 +31,37 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+// Request frames carry a 4 byte header per request, response frames a 1 byte
+// checksum plus a 2 byte header per response. By default a frame fits one
+// request of the maximum size, or several smaller ones.
+#ifndef RPC_M2S_FRAME_SIZE
+#    define RPC_M2S_FRAME_SIZE (RPC_M2S_BUFFER_SIZE + 4)
+#endif // RPC_M2S_FRAME_SIZE
+
+#ifndef RPC_S2M_FRAME_SIZE
+#    define RPC_S2M_FRAME_SIZE (RPC_S2M_BUFFER_SIZE + 3)
+#endif // RPC_S2M_FRAME_SIZE
+
+#ifndef RPC_QUEUE_SIZE
+#    define RPC_QUEUE_SIZE 4
+#endif // RPC_QUEUE_SIZE
+
+#ifndef RPC_MAX_ATTEMPTS
+#    define RPC_MAX_ATTEMPTS 3
+#endif // RPC_MAX_ATTEMPTS
+
+#ifndef SPLIT_STREAM_CHUNK_SIZE
+#    define SPLIT_STREAM_CHUNK_SIZE 32
+#endif // SPLIT_STREAM_CHUNK_SIZE
+
+#ifndef SPLIT_STREAM_BUFFER_CHUNKS
+#    define SPLIT_STREAM_BUFFER_CHUNKS 2
+#endif // SPLIT_STREAM_BUFFER_CHUNKS
+
+#ifndef SPLIT_STREAM_CHUNKS_PER_SCAN
+#    define SPLIT_STREAM_CHUNKS_PER_SCAN 1
+#endif // SPLIT_STREAM_CHUNKS_PER_SCAN
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -107,10 +138,25 @@ typedef struct _split_mods_sync_t {
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
+typedef struct _split_pointing_ack_t {
+    uint8_t sequence;
+    uint8_t inverse;
+} split_pointing_ack_t;
+
+typedef struct _split_pointing_motion_t {
+    uint8_t checksum;
+    uint8_t sequence;
+    uint8_t buttons;
+    int8_t  h;
+    int16_t x;
+    int16_t y;
+    int8_t  v;
+} split_pointing_motion_t;
+
 typedef struct _split_slave_pointing_sync_t {
-    uint8_t        checksum;
-    report_mouse_t report;
-    uint16_t       cpi;
+    split_pointing_ack_t    ack;
+    split_pointing_motion_t motion;
+    uint16_t                cpi;
 } split_slave_pointing_sync_t;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -135,13 +181,46 @@ typedef struct _split_slave_activity_sync_t {
 typedef struct _rpc_sync_info_t {
     uint8_t checksum;
     struct {
-        int8_t  transaction_id;
         uint8_t m2s_length;
         uint8_t s2m_length;
+        uint8_t m2s_checksum;
+        bool    reset; // Master booted, forget about the requests executed so far
     } payload;
 } rpc_sync_info_t;
+
+typedef struct _rpc_request_header_t {
+    uint8_t request_id;
+    int8_t  transaction_id;
+    uint8_t m2s_length;
+    uint8_t s2m_length;
+} rpc_request_header_t;
+
+typedef struct _rpc_response_header_t {
+    uint8_t request_id;
+    uint8_t s2m_length;
+} rpc_response_header_t;
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+#if defined(SPLIT_STREAM_ENABLE)
+typedef struct _split_stream_chunk_t {
+    uint8_t  checksum;
+    uint8_t  transfer_id;
+    uint8_t  channel;
+    uint8_t  length;
+    uint32_t offset;
+    uint32_t total_length;
+    uint8_t  data[SPLIT_STREAM_CHUNK_SIZE];
+} split_stream_chunk_t;
+
+typedef struct _split_stream_ack_t {
+    uint8_t  checksum;
+    uint8_t  transfer_id;
+    uint8_t  free_chunks;
+    uint8_t  reserved;
+    uint32_t offset;
+} split_stream_ack_t;
+#endif // defined(SPLIT_STREAM_ENABLE)
+
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
@@ -221,10 +300,15 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#if defined(SPLIT_STREAM_ENABLE)
+    split_stream_chunk_t stream_chunk;
+    split_stream_ack_t   stream_ack;
+#endif // defined(SPLIT_STREAM_ENABLE)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
-    uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
-    uint8_t         rpc_s2m_buffer[RPC_S2M_BUFFER_SIZE];
+    uint8_t         rpc_m2s_buffer[RPC_M2S_FRAME_SIZE];
+    uint8_t         rpc_s2m_buffer[RPC_S2M_FRAME_SIZE];
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
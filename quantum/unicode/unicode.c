@@ -136,7 +136,7 @@ static void unicode_play_song(uint8_t mode) {
 #endif
 
 void unicode_input_mode_init(void) {
-    unicode_config.raw = eeprom_read_byte(EECONFIG_UNICODEMODE);
+    eeconfig_read_record(EECONFIG_RECORD_UNICODEMODE, &unicode_config.raw);
 #if UNICODE_SELECTED_MODES != -1
 #    if UNICODE_CYCLE_PERSIST
     // Find input_mode in selected modes
@@ -165,7 +165,7 @@ uint8_t get_unicode_input_mode(void) {
 }
 
 static void persist_unicode_input_mode(void) {
-    eeprom_update_byte(EECONFIG_UNICODEMODE, unicode_config.input_mode);
+    eeconfig_update_record(EECONFIG_RECORD_UNICODEMODE, &unicode_config.raw);
 }
 
 void set_unicode_input_mode(uint8_t mode) {
@@ -18,11 +18,27 @@ void MockBackingStore::reset_instance() {
     backing_max_write_count   = 0;
     backing_total_write_count = 0;
 
-    backing_init_invoke_count   = 0;
-    backing_unlock_invoke_count = 0;
-    backing_erase_invoke_count  = 0;
-    backing_write_invoke_count  = 0;
-    backing_lock_invoke_count   = 0;
+    backing_init_invoke_count         = 0;
+    backing_unlock_invoke_count       = 0;
+    backing_erase_invoke_count        = 0;
+    backing_erase_sector_invoke_count = 0;
+    backing_write_invoke_count        = 0;
+    backing_lock_invoke_count         = 0;
+    backing_read_invoke_count         = 0;
+    backing_read_bulk_invoke_count    = 0;
+
+    backing_read_time_ns = 0;
+    read_transaction_ns  = 4000;
+    read_byte_ns         = 1000;
+
+    backing_write_time_ns = 0;
+    backing_erase_time_ns = 0;
+    write_ns              = 20000;
+    erase_sector_ns       = 45000000;
+
+    idle_time_ns = 0;
+
+    sector_count = 1;
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
@@ -56,6 +72,7 @@ bool MockBackingStore::unlock(void) {
 
 bool MockBackingStore::erase(void) {
     ++backing_erase_invoke_count;
+    backing_erase_time_ns += erase_sector_ns * sector_count;
 
     // Erase each slot
     for (std::size_t i = 0; i < backing_storage.size(); ++i) {
@@ -75,8 +92,34 @@ bool MockBackingStore::erase(void) {
     return true;
 }
 
+bool MockBackingStore::erase_sector(std::size_t index) {
+    ++backing_erase_sector_invoke_count;
+    backing_erase_time_ns += erase_sector_ns;
+
+    EXPECT_TRUE(index < sector_count) << "Attempted to erase a sector which is out of range";
+    EXPECT_FALSE(is_locked()) << "Erase was attempted without being unlocked first";
+
+    // Erase each slot of the sector
+    std::size_t sector_size = backing_storage.size() / sector_count;
+    for (std::size_t i = index * sector_size; i < (index + 1) * sector_size; ++i) {
+        // Drop out of erase early with failure if we need to
+        if (erase_success_callback && !erase_success_callback(backing_erase_sector_invoke_count)) {
+            return false;
+        }
+
+        backing_storage[i].erase();
+    }
+
+    // A full erase cycle has occurred once the last sector is erased
+    if (index == sector_count - 1) {
+        ++backing_erasure_count;
+    }
+    return true;
+}
+
 bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     ++backing_write_invoke_count;
+    backing_write_time_ns += write_ns;
 
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
@@ -113,7 +156,10 @@ bool MockBackingStore::lock(void) {
     return true;
 }
 
-bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const {
+bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) {
+    ++backing_read_invoke_count;
+    backing_read_time_ns += read_transaction_ns + read_byte_ns * BACKING_STORE_WRITE_SIZE;
+
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
@@ -125,6 +171,22 @@ bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const
     return true;
 }
 
+bool MockBackingStore::read_bulk(uint32_t address, backing_store_int_t* values, std::size_t item_count) {
+    ++backing_read_bulk_invoke_count;
+    backing_read_time_ns += read_transaction_ns + read_byte_ns * BACKING_STORE_WRITE_SIZE * item_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE * item_count <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+
+    // Read and take the complement as we're simulating flash memory -- 0xFF means 0x00
+    std::size_t index = address / BACKING_STORE_WRITE_SIZE;
+    for (std::size_t i = 0; i < item_count; ++i) {
+        values[i] = ~backing_storage[index + i].get();
+    }
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Backing Implementation
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,6 +203,14 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+extern "C" size_t backing_store_erase_sector_count(void) {
+    return MockBackingStore::Instance().get_sector_count();
+}
+
+extern "C" bool backing_store_erase_sector(size_t index) {
+    return MockBackingStore::Instance().erase_sector(index);
+}
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
@@ -152,3 +222,25 @@ extern "C" bool backing_store_lock(void) {
 extern "C" bool backing_store_read(uint32_t address, backing_store_int_t* value) {
     return MockBackingStore::Instance().read(address, *value);
 }
+
+extern "C" bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) {
+    return MockBackingStore::Instance().read_bulk(address, values, item_count);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Timer Implementation
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The clock advances with the simulated time spent in the backing store, and with any idle time added by the tests
+
+extern "C" uint32_t timer_read32(void) {
+    return (uint32_t)(MockBackingStore::Instance().clock_ns() / 1000000);
+}
+
+extern "C" uint32_t timer_elapsed32(uint32_t last) {
+    return timer_read32() - last;
+}
+
+extern "C" uint32_t wear_leveling_timer_read_us(void) {
+    return (uint32_t)(MockBackingStore::Instance().clock_ns() / 1000);
+}
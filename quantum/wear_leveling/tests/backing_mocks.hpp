@@ -89,13 +89,32 @@ class MockBackingStore {
     std::uint64_t backing_total_write_count;
     // The write log for the backing store
     std::vector<MockBackingStoreLogEntry> write_log;
+    // The number of separately erasable sectors
+    std::size_t sector_count;
 
     // The number of times each API was invoked
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
+    std::uint64_t backing_erase_sector_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
+    std::uint64_t backing_read_invoke_count;
+    std::uint64_t backing_read_bulk_invoke_count;
+
+    // Simulated time spent reading, given the cost of each read transaction and of each byte read
+    std::uint64_t backing_read_time_ns;
+    std::uint64_t read_transaction_ns;
+    std::uint64_t read_byte_ns;
+
+    // Simulated time spent writing and erasing, given the cost of each write and of each sector erased
+    std::uint64_t backing_write_time_ns;
+    std::uint64_t backing_erase_time_ns;
+    std::uint64_t write_ns;
+    std::uint64_t erase_sector_ns;
+
+    // Simulated time spent outside of the backing store
+    std::uint64_t idle_time_ns;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -141,12 +160,41 @@ class MockBackingStore {
     std::uint64_t erase_invoke_count() const {
         return backing_erase_invoke_count;
     }
+    std::uint64_t erase_sector_invoke_count() const {
+        return backing_erase_sector_invoke_count;
+    }
     std::uint64_t write_invoke_count() const {
         return backing_write_invoke_count;
     }
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
+    std::uint64_t read_bulk_invoke_count() const {
+        return backing_read_bulk_invoke_count;
+    }
+    std::uint64_t read_time_ns() const {
+        return backing_read_time_ns;
+    }
+    std::uint64_t write_time_ns() const {
+        return backing_write_time_ns;
+    }
+    std::uint64_t erase_time_ns() const {
+        return backing_erase_time_ns;
+    }
+    // Total simulated time spent in the backing store
+    std::uint64_t time_ns() const {
+        return backing_read_time_ns + backing_write_time_ns + backing_erase_time_ns;
+    }
+    // Simulated time including time spent outside of the backing store, which drives the timer seen by the wear-leveling code
+    std::uint64_t clock_ns() const {
+        return time_ns() + idle_time_ns;
+    }
+    void advance_clock(std::uint64_t ns) {
+        idle_time_ns += ns;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -159,9 +207,31 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_sector(std::size_t index);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
-    bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool read(std::uint32_t address, backing_store_int_t& value);
+    bool read_bulk(std::uint32_t address, backing_store_int_t* values, std::size_t item_count);
+
+    // Number of separately erasable sectors, which need to evenly divide the backing store
+    std::size_t get_sector_count() const {
+        return sector_count;
+    }
+    void set_sector_count(std::size_t count) {
+        sector_count = count;
+    }
+
+    // Cost of reads, defaults to a SPI NOR flash clocked at 8MHz: command and address, then 1us per byte
+    void set_read_timing(std::uint64_t transaction_ns, std::uint64_t byte_ns) {
+        read_transaction_ns = transaction_ns;
+        read_byte_ns        = byte_ns;
+    }
+
+    // Cost of writes and erases, defaults to the same flash: 20us per write, 45ms per sector erase
+    void set_write_timing(std::uint64_t write_time_ns, std::uint64_t erase_sector_time_ns) {
+        write_ns        = write_time_ns;
+        erase_sector_ns = erase_sector_time_ns;
+    }
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
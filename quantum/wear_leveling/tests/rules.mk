@@ -63,4 +63,84 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
-	$(wear_leveling_common_INC)
\ No newline at end of file
+	$(wear_leveling_common_INC)
+wear_leveling_background_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16 \
+	-DWEAR_LEVELING_BANK_COUNT=2 \
+	-DWEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE=8 \
+	-DWEAR_LEVELING_CONSOLIDATION_RESERVE=0 \
+	-DWEAR_LEVELING_BACKGROUND_CONSOLIDATION
+wear_leveling_background_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_background.cpp
+wear_leveling_background_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_background_banks_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16 \
+	-DWEAR_LEVELING_BANK_COUNT=2 \
+	-DWEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE=8 \
+	-DWEAR_LEVELING_CONSOLIDATION_RESERVE=16 \
+	-DWEAR_LEVELING_BACKGROUND_CONSOLIDATION \
+	-DWEAR_LEVELING_SKIP_BLANK_SECTORS
+wear_leveling_background_banks_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_background_banks.cpp
+wear_leveling_background_banks_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_banks_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16 \
+	-DWEAR_LEVELING_BANK_COUNT=2
+wear_leveling_banks_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_banks.cpp
+wear_leveling_banks_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_playback_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=8192 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024
+wear_leveling_playback_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_playback.cpp
+wear_leveling_playback_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_statistics_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=256 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32 \
+	-DWEAR_LEVELING_BANK_COUNT=2 \
+	-DWEAR_LEVELING_STATISTICS
+wear_leveling_statistics_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_statistics.cpp
+wear_leveling_statistics_INC := \
+	$(wear_leveling_common_INC) \
+	$(PLATFORM_PATH)
+
+wear_leveling_simulator_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=4096 \
+	-DWEAR_LEVELING_STATISTICS
+wear_leveling_simulator_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_simulator.cpp
+wear_leveling_simulator_INC := \
+	$(wear_leveling_common_INC) \
+	$(PLATFORM_PATH)
@@ -3,4 +3,10 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_background \
+	wear_leveling_background_banks \
+	wear_leveling_banks \
+	wear_leveling_playback \
+	wear_leveling_statistics \
+	wear_leveling_simulator
@@ -60,8 +60,9 @@ TEST_F(WearLeveling4Byte, MultibyteBackingStoreWriteCounts) {
         // Write the data
         EXPECT_EQ(test_write(0, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write failed with incorrect status";
 
+        // Two bytes fit into a compact word entry
         std::size_t expected;
-        if (length > 1) {
+        if (length > 2) {
             expected = 2;
         } else {
             expected = 1;
@@ -72,6 +73,83 @@ TEST_F(WearLeveling4Byte, MultibyteBackingStoreWriteCounts) {
     }
 }
 
+/**
+ * This test verifies that 16-bit values are written as a single compact entry, and played back on initialisation.
+ */
+TEST_F(WearLeveling4Byte, CompactWordEntry) {
+    auto&         inst       = MockBackingStore::Instance();
+    std::uint16_t test_value = 0x1234;
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    EXPECT_EQ(test_write(0x06, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 1) << "Invalid number of backing store writes";
+
+    write_log_entry_t e;
+    e.raw32[0] = inst.log_begin()->value;
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_COMPACT) << "Invalid write log entry type";
+    EXPECT_EQ(LOG_ENTRY_COMPACT_GET_TYPE(e), LOG_ENTRY_COMPACT_WORD) << "Invalid compact write log entry type";
+    EXPECT_EQ(LOG_ENTRY_COMPACT_GET_ADDRESS(e), 0x06) << "Invalid write log entry address";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_EQ(readback, verify_data) << "Readback did not match";
+}
+
+/**
+ * This test verifies that runs of identical bytes are written as a single compact entry, and played back on initialisation.
+ */
+TEST_F(WearLeveling4Byte, CompactRunEntry) {
+    auto&                        inst = MockBackingStore::Instance();
+    std::array<std::uint8_t, 11> test_value;
+    std::fill(test_value.begin(), test_value.end(), 0xA5);
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    EXPECT_EQ(test_write(0x03, test_value.data(), test_value.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 1) << "Invalid number of backing store writes";
+
+    write_log_entry_t e;
+    e.raw32[0] = inst.log_begin()->value;
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_COMPACT) << "Invalid write log entry type";
+    EXPECT_EQ(LOG_ENTRY_COMPACT_GET_TYPE(e), LOG_ENTRY_COMPACT_RUN) << "Invalid compact write log entry type";
+    EXPECT_EQ(LOG_ENTRY_COMPACT_GET_ADDRESS(e), 0x03) << "Invalid write log entry address";
+    EXPECT_EQ(LOG_ENTRY_COMPACT_RUN_GET_LENGTH(e), test_value.size()) << "Invalid write log entry length";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_EQ(readback, verify_data) << "Readback did not match";
+}
+
+/**
+ * This test verifies that only the bytes which changed are written to the write log.
+ */
+TEST_F(WearLeveling4Byte, OnlyChangedBytesAreLogged) {
+    auto&                                                inst = MockBackingStore::Instance();
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> test_value;
+    std::fill(test_value.begin(), test_value.end(), 0);
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    // Two single changed bytes, far enough apart to be logged separately
+    test_value[2]  = 0x11;
+    test_value[13] = 0x22;
+    EXPECT_EQ(test_write(0, test_value.data(), test_value.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 2) << "Invalid number of backing store writes";
+
+    write_log_entry_t e;
+    e.raw32[0] = inst.log_begin()->value;
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_MULTIBYTE) << "Invalid write log entry type";
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_ADDRESS(e), 2) << "Invalid write log entry address";
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(e), 1) << "Invalid write log entry length";
+    e.raw32[0] = (inst.log_begin() + 1)->value;
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_ADDRESS(e), 13) << "Invalid write log entry address";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_EQ(readback, verify_data) << "Readback did not match";
+}
+
 /**
  * This test forces consolidation by writing enough to the write log that it overflows, consolidating the data into the
  * base logical area.
@@ -191,3 +269,32 @@ TEST_F(WearLeveling4Byte, PlaybackReadbackMultibyte_OOB) {
     EXPECT_EQ(buf[0], 0x11) << "Readback should have maintained the previous pre-failure value from the write log";
     EXPECT_EQ(buf[1], 0x12) << "Readback should have maintained the previous pre-failure value from the write log";
 }
+
+/**
+ * This test verifies compact run readback gets canceled with an out-of-bounds length.
+ */
+TEST_F(WearLeveling4Byte, PlaybackReadbackCompactRun_OOB) {
+    auto& inst     = MockBackingStore::Instance();
+    auto  logstart = inst.storage_begin() + (WEAR_LEVELING_LOGICAL_SIZE / sizeof(backing_store_int_t));
+
+    // Invalid FNV1a_64 hash
+    (logstart + 0)->set(0);
+    (logstart + 1)->set(0);
+
+    // Set up a 2-byte logical write of [0x11,0x11] at logical offset 0x01
+    auto entry0 = LOG_ENTRY_MAKE_COMPACT_RUN(0x01, 2, 0x11);
+    (logstart + 2)->set(~entry0.raw32[0]);
+
+    // Set up a 16-byte logical write of 0x13 at logical offset 0x08 (out of bounds)
+    auto entry1 = LOG_ENTRY_MAKE_COMPACT_RUN(0x08, 16, 0x13);
+    (logstart + 3)->set(~entry1.raw32[0]);
+
+    EXPECT_EQ(inst.erasure_count(), 0) << "Invalid initial erase count";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Readback should have failed and triggered consolidation";
+    EXPECT_EQ(inst.erasure_count(), 1) << "Invalid final erase count";
+
+    uint8_t buf[2];
+    wear_leveling_read(0x01, buf, sizeof(buf));
+    EXPECT_EQ(buf[0], 0x11) << "Readback should have maintained the previous pre-failure value from the write log";
+    EXPECT_EQ(buf[1], 0x11) << "Readback should have maintained the previous pre-failure value from the write log";
+}
@@ -65,6 +65,53 @@ TEST_F(WearLeveling8Byte, MultibyteBackingStoreWriteCounts) {
     }
 }
 
+/**
+ * This test verifies that runs of identical bytes too long for a multibyte entry are written as a single compact entry.
+ */
+TEST_F(WearLeveling8Byte, CompactRunEntry) {
+    auto&                                                inst = MockBackingStore::Instance();
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> test_value;
+    std::fill(test_value.begin(), test_value.end(), 0x5A);
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    EXPECT_EQ(test_write(0, test_value.data(), test_value.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 1) << "Invalid number of backing store writes";
+
+    write_log_entry_t e;
+    e.raw64 = inst.log_begin()->value;
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_COMPACT) << "Invalid write log entry type";
+    EXPECT_EQ(LOG_ENTRY_COMPACT_GET_TYPE(e), LOG_ENTRY_COMPACT_RUN) << "Invalid compact write log entry type";
+    EXPECT_EQ(LOG_ENTRY_COMPACT_GET_ADDRESS(e), 0) << "Invalid write log entry address";
+    EXPECT_EQ(LOG_ENTRY_COMPACT_RUN_GET_LENGTH(e), WEAR_LEVELING_LOGICAL_SIZE) << "Invalid write log entry length";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_EQ(readback, verify_data) << "Readback did not match";
+}
+
+/**
+ * This test verifies that only the bytes which changed are written to the write log.
+ */
+TEST_F(WearLeveling8Byte, OnlyChangedBytesAreLogged) {
+    auto&                       inst = MockBackingStore::Instance();
+    std::array<std::uint8_t, 5> test_value;
+    std::iota(test_value.begin(), test_value.end(), 0x20);
+    EXPECT_EQ(test_write(0, test_value.data(), test_value.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    auto writes = std::distance(inst.log_begin(), inst.log_end());
+
+    // A single changed byte, written along with everything else
+    test_value[3] = 0x00;
+    EXPECT_EQ(test_write(0, test_value.data(), test_value.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), writes + 1) << "Invalid number of backing store writes";
+
+    write_log_entry_t e;
+    e.raw64 = (inst.log_end() - 1)->value;
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_MULTIBYTE) << "Invalid write log entry type";
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_ADDRESS(e), 3) << "Invalid write log entry address";
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(e), 1) << "Invalid write log entry length";
+}
+
 /**
  * This test forces consolidation by writing enough to the write log that it overflows, consolidating the data into the
  * base logical area.
@@ -0,0 +1,160 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+#define TEST_SECTOR_COUNT 4
+#define TEST_BANK_SECTORS (TEST_SECTOR_COUNT / WEAR_LEVELING_BANK_COUNT)
+#define TEST_CHUNK_COUNT ((WEAR_LEVELING_LOGICAL_SIZE) / (WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE))
+
+class WearLevelingBackground : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        MockBackingStore::Instance().set_sector_count(TEST_SECTOR_COUNT);
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    // Writes single bytes until the write log is full, there's no reserve for writes made while consolidating
+    void fill_log(void) {
+        for (uint8_t i = 0; !wear_leveling_consolidation_pending(); ++i) {
+            uint8_t value = i + 0x40;
+            EXPECT_EQ(test_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        }
+    }
+
+    void verify_reinit(void) {
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed with incorrect status";
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> data;
+        wear_leveling_read(0, data.data(), data.size());
+        EXPECT_EQ(data, verify_data) << "Data did not survive re-initialisation";
+    }
+};
+
+/**
+ * This test verifies that a full write log never erases the backing store in-line.
+ */
+TEST_F(WearLevelingBackground, FullLogDoesNotEraseInline) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+
+    uint8_t value = 0x55;
+    EXPECT_EQ(test_write(0x03, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    EXPECT_TRUE(wear_leveling_consolidation_pending()) << "Consolidation should be pending";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Backing store was erased in-line";
+    EXPECT_EQ(inst.erase_sector_invoke_count(), 0) << "Backing store was erased in-line";
+}
+
+/**
+ * This test verifies that consolidation takes one task invocation per sector and per chunk of consolidated data.
+ */
+TEST_F(WearLevelingBackground, TaskCompletesInSteps) {
+    auto& inst = MockBackingStore::Instance();
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Idle task returned incorrect status";
+    EXPECT_EQ(inst.unlock_invoke_count(), 0) << "Idle task should not touch the backing store";
+
+    fill_log();
+
+    for (int i = 0; i < TEST_BANK_SECTORS + TEST_CHUNK_COUNT - 1; ++i) {
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task step returned incorrect status";
+        EXPECT_TRUE(wear_leveling_consolidation_pending()) << "Consolidation completed early";
+    }
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_CONSOLIDATED) << "Final task step returned incorrect status";
+    EXPECT_FALSE(wear_leveling_consolidation_pending()) << "Consolidation should have completed";
+
+    EXPECT_EQ(inst.erase_sector_invoke_count(), TEST_BANK_SECTORS) << "Invalid number of sector erasures";
+    verify_reinit();
+}
+
+/**
+ * This test verifies that writes made while consolidation is in progress survive, whichever phase they were made in.
+ */
+TEST_F(WearLevelingBackground, WritesDuringConsolidationSurvive) {
+    fill_log();
+
+    // Written while erasing
+    uint8_t value = 0xA1;
+    test_write(0x00, &value, sizeof(value));
+    for (int i = 0; i < TEST_BANK_SECTORS; ++i) {
+        wear_leveling_task();
+    }
+
+    // First chunk has been written out, then modified
+    wear_leveling_task();
+    uint16_t value16 = 0xB2C3;
+    test_write(0x01, &value16, sizeof(value16));
+
+    // Not written out yet
+    value = 0xD4;
+    test_write(WEAR_LEVELING_LOGICAL_SIZE - 1, &value, sizeof(value));
+
+    while (wear_leveling_consolidation_pending()) {
+        wear_leveling_task();
+    }
+    verify_reinit();
+}
+
+/**
+ * This test verifies that writes made while consolidation is in progress only update the cache.
+ */
+TEST_F(WearLevelingBackground, WritesDuringConsolidationAreCached) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+
+    auto    writes = inst.write_invoke_count();
+    uint8_t value  = 0x66;
+    EXPECT_EQ(test_write(0x05, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), writes) << "Backing store was written while consolidation is pending";
+
+    uint8_t read_value = 0;
+    wear_leveling_read(0x05, &read_value, sizeof(read_value));
+    EXPECT_EQ(read_value, value) << "Cache was not updated";
+}
+
+/**
+ * This test verifies that a failed step restarts consolidation from scratch.
+ */
+TEST_F(WearLevelingBackground, FailedStepRestarts) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+
+    // The second sector fails to erase
+    inst.set_erase_callback([](std::uint64_t count) { return count != 2; });
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task step returned incorrect status";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Failed task step returned incorrect status";
+    EXPECT_TRUE(wear_leveling_consolidation_pending()) << "Consolidation should still be pending";
+
+    int steps = 0;
+    while (wear_leveling_consolidation_pending()) {
+        wear_leveling_task();
+        ++steps;
+    }
+    EXPECT_EQ(steps, TEST_BANK_SECTORS + TEST_CHUNK_COUNT) << "Consolidation did not restart from the first sector";
+    verify_reinit();
+}
+
+/**
+ * This test verifies that erasing cancels a pending consolidation.
+ */
+TEST_F(WearLevelingBackground, EraseCancelsConsolidation) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+    wear_leveling_task();
+
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    EXPECT_FALSE(wear_leveling_consolidation_pending()) << "Consolidation should have been cancelled";
+
+    auto sectors = inst.erase_sector_invoke_count();
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Idle task returned incorrect status";
+    EXPECT_EQ(inst.erase_sector_invoke_count(), sectors) << "Cancelled consolidation kept erasing";
+}
@@ -0,0 +1,108 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+#define TEST_SECTOR_COUNT 4
+
+class WearLevelingBackgroundBanks : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        MockBackingStore::Instance().set_sector_count(TEST_SECTOR_COUNT);
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    // Writes single bytes until consolidation is scheduled, which leaves the reserved part of the log
+    void fill_log(void) {
+        for (uint8_t i = 0; !wear_leveling_consolidation_pending(); ++i) {
+            uint8_t value = i + 0x40;
+            EXPECT_EQ(test_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        }
+    }
+
+    void verify_reinit(void) {
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed with incorrect status";
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> data;
+        wear_leveling_read(0, data.data(), data.size());
+        EXPECT_EQ(data, verify_data) << "Data did not survive re-initialisation";
+    }
+};
+
+/**
+ * This test verifies that writes made while consolidating into the next bank go to the reserved part of the current log,
+ * so they survive a power loss before consolidation completes.
+ */
+TEST_F(WearLevelingBackgroundBanks, WritesInReserveSurvivePowerLoss) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+
+    // Written while erasing
+    auto    writes = inst.write_invoke_count();
+    uint8_t value  = 0xA1;
+    EXPECT_EQ(test_write(0x09, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_GT(inst.write_invoke_count(), writes) << "Write was not logged";
+
+    // Written after the first chunk of consolidated data
+    while (wear_leveling_consolidation_pending() && inst.write_invoke_count() == writes + 1) {
+        wear_leveling_task();
+    }
+    EXPECT_TRUE(wear_leveling_consolidation_pending()) << "Consolidation completed early";
+    value = 0xB2;
+    EXPECT_EQ(test_write(0x00, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    // Power is lost before the next bank is complete
+    verify_reinit();
+    EXPECT_TRUE(wear_leveling_consolidation_pending()) << "Consolidation should be scheduled again";
+
+    while (wear_leveling_consolidation_pending()) {
+        wear_leveling_task();
+    }
+    verify_reinit();
+}
+
+/**
+ * This test verifies that writes which don't fit into the reserve are only cached, and still make it into the next bank.
+ */
+TEST_F(WearLevelingBackgroundBanks, WritesBeyondReserveSurviveConsolidation) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+
+    for (uint8_t i = 0; i < WEAR_LEVELING_LOGICAL_SIZE; ++i) {
+        uint8_t value = i + 0x80;
+        EXPECT_EQ(test_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    auto    writes = inst.write_invoke_count();
+    uint8_t value  = 0xC3;
+    EXPECT_EQ(test_write(0x05, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), writes) << "Write past the reserve was logged";
+
+    while (wear_leveling_consolidation_pending()) {
+        wear_leveling_task();
+    }
+    verify_reinit();
+}
+
+/**
+ * This test verifies that sectors which already read back as erased aren't erased again.
+ */
+TEST_F(WearLevelingBackgroundBanks, BlankSectorsAreSkipped) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+
+    while (wear_leveling_consolidation_pending()) {
+        EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Task returned incorrect status";
+    }
+    EXPECT_EQ(inst.erase_sector_invoke_count(), 0) << "Blank bank was erased";
+    verify_reinit();
+}
@@ -0,0 +1,224 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+#define TEST_SECTOR_COUNT 4
+#define TEST_BANK_SECTORS (TEST_SECTOR_COUNT / WEAR_LEVELING_BANK_COUNT)
+#define TEST_LOG_START (WEAR_LEVELING_LOGICAL_SIZE + 16)
+
+class WearLevelingBanks : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        MockBackingStore::Instance().set_sector_count(TEST_SECTOR_COUNT);
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        next_value = 0x40;
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+    std::uint8_t                                         next_value;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    // Writes single bytes until data is consolidated into the next bank
+    void fill_log(void) {
+        wear_leveling_status_t status;
+        do {
+            uint8_t value = next_value++;
+            status        = test_write(value % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+        } while (status == WEAR_LEVELING_SUCCESS);
+        EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+    }
+
+    // Address of the next write log entry
+    uint32_t next_write_address(void) {
+        auto&   inst  = MockBackingStore::Instance();
+        uint8_t value = ~verify_data[0];
+        test_write(0, &value, sizeof(value));
+        return (inst.log_end() - 1)->address;
+    }
+
+    void verify_reinit(void) {
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> data;
+        wear_leveling_read(0, data.data(), data.size());
+        EXPECT_EQ(data, verify_data) << "Data did not survive re-initialisation";
+    }
+};
+
+/**
+ * This test verifies that the first write occurs after the bank header, made up of the FNV1a_64 hash and the generation.
+ */
+TEST_F(WearLevelingBanks, FirstWriteOccursAfterHeader) {
+    EXPECT_EQ(next_write_address(), TEST_LOG_START) << "Invalid first write address.";
+}
+
+/**
+ * This test verifies that consolidation writes to the next bank, erasing only that bank if the task hasn't done so yet.
+ */
+TEST_F(WearLevelingBanks, ConsolidationWritesNextBank) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Backing store was erased during consolidation";
+    EXPECT_EQ(inst.erase_sector_invoke_count(), TEST_BANK_SECTORS) << "Next bank was not erased during consolidation";
+    EXPECT_EQ(next_write_address(), WEAR_LEVELING_BANK_SIZE + TEST_LOG_START) << "Invalid write address after consolidation.";
+    verify_reinit();
+}
+
+/**
+ * This test verifies that the task erases the previous bank once the write log fills up, so that the next consolidation
+ * only writes.
+ */
+TEST_F(WearLevelingBanks, TaskErasesNextBank) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+
+    // Nothing to do while the write log has plenty of room
+    auto unlocks = inst.unlock_invoke_count();
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Idle task returned incorrect status";
+    EXPECT_EQ(inst.unlock_invoke_count(), unlocks) << "Task erased the next bank with an empty write log";
+
+    // Run the task between writes, as the main loop would
+    const auto             initial_erases = inst.erase_sector_invoke_count();
+    auto                   erases         = initial_erases;
+    int                    writes         = 0;
+    int                    erase_start    = -1;
+    wear_leveling_status_t status;
+    do {
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+        erases = inst.erase_sector_invoke_count();
+        if (erases != initial_erases && erase_start < 0) {
+            erase_start = writes;
+        }
+        uint8_t value = next_value++;
+        status        = test_write(value % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+        ++writes;
+    } while (status == WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+
+    EXPECT_GT(erase_start, 0) << "Task started erasing before the write log filled up";
+    EXPECT_EQ(erases - initial_erases, TEST_BANK_SECTORS) << "Previous bank was not erased";
+    EXPECT_EQ(inst.erase_sector_invoke_count(), erases) << "Consolidation erased the pre-erased bank";
+    EXPECT_EQ(next_write_address(), TEST_LOG_START) << "Consolidation did not wrap around to the first bank.";
+    verify_reinit();
+}
+
+/**
+ * This test verifies that restarting doesn't erase the next bank again, so that erasures only depend on writes.
+ */
+TEST_F(WearLevelingBanks, RestartDoesNotEraseNextBank) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+
+    auto erases = inst.erase_sector_invoke_count();
+    for (int i = 0; i < 4; ++i) {
+        verify_reinit();
+        for (int j = 0; j < TEST_SECTOR_COUNT; ++j) {
+            EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+        }
+    }
+    EXPECT_EQ(inst.erase_sector_invoke_count(), erases) << "Next bank was erased again after a restart";
+}
+
+/**
+ * This test verifies that the next bank isn't erased again after the whole backing store has been erased.
+ */
+TEST_F(WearLevelingBanks, EraseLeavesNextBankErased) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    auto erases = inst.erase_sector_invoke_count();
+    fill_log();
+    EXPECT_EQ(inst.erase_sector_invoke_count(), erases) << "Consolidation erased a bank which was just erased";
+    EXPECT_EQ(next_write_address(), WEAR_LEVELING_BANK_SIZE + TEST_LOG_START) << "Invalid write address after consolidation.";
+    verify_reinit();
+}
+
+/**
+ * This test verifies that every bank gets erased evenly.
+ */
+TEST_F(WearLevelingBanks, ErasuresAreSpreadAcrossBanks) {
+    auto& inst = MockBackingStore::Instance();
+    for (int i = 0; i < 8; ++i) {
+        fill_log();
+        for (int j = 0; j < TEST_SECTOR_COUNT; ++j) {
+            wear_leveling_task();
+        }
+    }
+
+    std::array<std::size_t, WEAR_LEVELING_BANK_COUNT> erases = {0};
+    for (auto it = inst.storage_begin(); it != inst.storage_end(); ++it) {
+        std::size_t bank = (it - inst.storage_begin()) * BACKING_STORE_WRITE_SIZE / WEAR_LEVELING_BANK_SIZE;
+        erases[bank]     = std::max(erases[bank], it->num_erases());
+    }
+    EXPECT_EQ(inst.erase_sector_invoke_count(), 8 * TEST_BANK_SECTORS) << "Invalid number of erased sectors";
+    EXPECT_LE(std::max(erases[0], erases[1]) - std::min(erases[0], erases[1]), 1) << "Banks were not erased evenly";
+    verify_reinit();
+}
+
+/**
+ * This test verifies that initialisation picks the newest bank, even if an older one is still intact.
+ */
+TEST_F(WearLevelingBanks, InitPicksNewestBank) {
+    // Without the task, the first bank is only erased when consolidating into it
+    fill_log();
+    fill_log();
+
+    uint8_t value = 0xEE;
+    test_write(0x07, &value, sizeof(value));
+    verify_reinit();
+    EXPECT_EQ(next_write_address(), TEST_LOG_START + BACKING_STORE_WRITE_SIZE) << "Initialisation picked the wrong bank.";
+}
+
+/**
+ * This test verifies that a consolidation interrupted before the hash was written falls back to the previous bank.
+ */
+TEST_F(WearLevelingBanks, InterruptedConsolidationFallsBack) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log();
+    for (int i = 0; i < TEST_SECTOR_COUNT; ++i) {
+        wear_leveling_task();
+    }
+
+    // Power is lost before the hash of the first bank is written
+    inst.set_write_callback([](std::uint64_t, std::uint32_t address) { return address != WEAR_LEVELING_LOGICAL_SIZE; });
+    wear_leveling_status_t status;
+    do {
+        uint8_t value = next_value++;
+        status        = test_write(value % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+    } while (status == WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(status, WEAR_LEVELING_FAILED) << "Interrupted consolidation returned incorrect status";
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    verify_reinit();
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+}
+
+/**
+ * This test verifies that erasing starts over from the first bank.
+ */
+TEST_F(WearLevelingBanks, EraseResetsToFirstBank) {
+    fill_log();
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    EXPECT_EQ(next_write_address(), TEST_LOG_START) << "Invalid first write address after erase.";
+    verify_reinit();
+}
+
+/**
+ * This test verifies that initialisation fails if banks can't be erased separately.
+ */
+TEST_F(WearLevelingBanks, InitRequiresSectorPerBank) {
+    MockBackingStore::Instance().set_sector_count(1);
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Initialisation should have failed";
+}
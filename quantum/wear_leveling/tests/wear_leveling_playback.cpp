@@ -0,0 +1,127 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+// Single byte writes past the optimized range take a 4-byte multi-byte log entry each
+#define TEST_ENTRY_SIZE 4
+#define TEST_LOG_SIZE (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8)
+#define TEST_LOG_CAPACITY (TEST_LOG_SIZE / TEST_ENTRY_SIZE)
+
+class WearLevelingPlayback : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        written = 0;
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+    std::size_t                                          written;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    void fill_log(std::size_t entries) {
+        for (std::size_t i = written; i < written + entries; ++i) {
+            uint32_t address = 64 + (i * 2 + 1) % (WEAR_LEVELING_LOGICAL_SIZE - 64);
+            uint8_t  value   = (i % 255) + 1;
+            EXPECT_EQ(test_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        }
+        written += entries;
+    }
+
+    // Number of bulk reads needed to reach the given offset into the write log
+    static std::size_t playback_reads(std::size_t offset) {
+        std::size_t reads = 0, read_ahead = 8;
+        for (std::size_t position = 0; position <= offset; position += read_ahead, read_ahead = std::min<std::size_t>(read_ahead * 2, WEAR_LEVELING_PLAYBACK_BLOCK_SIZE)) {
+            ++reads;
+        }
+        return reads;
+    }
+
+    // Re-initialises, returning the simulated time spent reading the backing store
+    std::uint64_t boot(void) {
+        auto& inst  = MockBackingStore::Instance();
+        auto  start = inst.read_time_ns();
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed with incorrect status";
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> data;
+        wear_leveling_read(0, data.data(), data.size());
+        EXPECT_EQ(data, verify_data) << "Data did not survive re-initialisation";
+        return inst.read_time_ns() - start;
+    }
+};
+
+/**
+ * This test verifies that log entries of any length are played back correctly, whichever block they end up in.
+ */
+TEST_F(WearLevelingPlayback, PlaybackAcrossBlocks) {
+    uint8_t buffer[16];
+    for (uint32_t i = 0; i < 200; ++i) {
+        const size_t   length  = 1 + i % sizeof(buffer);
+        const uint32_t address = (i * 37) % (WEAR_LEVELING_LOGICAL_SIZE - length);
+        for (size_t j = 0; j < length; ++j) {
+            buffer[j] = (uint8_t)(i + j * 3);
+        }
+        test_write(address, buffer, length);
+    }
+    boot();
+}
+
+/**
+ * This test verifies that the write log is read in blocks rather than one value at a time.
+ */
+TEST_F(WearLevelingPlayback, PlaybackReadsInBlocks) {
+    auto&             inst    = MockBackingStore::Instance();
+    const std::size_t entries = TEST_LOG_CAPACITY / 2;
+    fill_log(entries);
+
+    auto reads = inst.read_invoke_count();
+    auto bulks = inst.read_bulk_invoke_count();
+    boot();
+
+    // Consolidated data and its hash, then every block of the log up to and including the first empty slot
+    EXPECT_EQ(inst.read_invoke_count(), reads) << "Write log was read one value at a time";
+    EXPECT_EQ(inst.read_bulk_invoke_count() - bulks, 2 + playback_reads(entries * TEST_ENTRY_SIZE)) << "Invalid number of reads during playback";
+}
+
+/**
+ * This test verifies that an empty write log costs a single block read.
+ */
+TEST_F(WearLevelingPlayback, EmptyLogReadsSingleBlock) {
+    auto& inst  = MockBackingStore::Instance();
+    auto  bulks = inst.read_bulk_invoke_count();
+    boot();
+    EXPECT_EQ(inst.read_bulk_invoke_count() - bulks, 3) << "Invalid number of reads during playback";
+}
+
+/**
+ * This test measures boot time depending on how full the write log is, against reading it one value at a time.
+ */
+TEST_F(WearLevelingPlayback, BootTime) {
+    const std::uint64_t transaction_ns = 4000;
+    const std::uint64_t byte_ns        = 1000;
+    MockBackingStore::Instance().set_read_timing(transaction_ns, byte_ns);
+
+    for (int quarter = 0; quarter <= 4; ++quarter) {
+        std::size_t entries = (TEST_LOG_CAPACITY - 1) * quarter / 4;
+        fill_log(entries - written);
+
+        // Consolidated data and its hash, then the write log a value at a time up to and including the first empty slot
+        std::uint64_t boot_ns     = boot();
+        std::uint64_t words       = (entries * TEST_ENTRY_SIZE) / BACKING_STORE_WRITE_SIZE + 1;
+        std::uint64_t per_word_ns = 2 * transaction_ns + (WEAR_LEVELING_LOGICAL_SIZE + 8) * byte_ns + words * (transaction_ns + BACKING_STORE_WRITE_SIZE * byte_ns);
+        RecordProperty("boot_us_log_" + std::to_string(quarter * 25) + "_percent", std::to_string(boot_ns / 1000));
+        RecordProperty("per_word_boot_us_log_" + std::to_string(quarter * 25) + "_percent", std::to_string(per_word_ns / 1000));
+
+        // The first read covers a whole log entry rather than a single value
+        EXPECT_LE(boot_ns, per_word_ns + transaction_ns + 8 * byte_ns) << "Playback of an empty log is slower than reading a value at a time";
+        if (quarter >= 2) {
+            EXPECT_LT(boot_ns * 2, per_word_ns) << "Playback is not faster than reading a value at a time";
+        }
+    }
+}
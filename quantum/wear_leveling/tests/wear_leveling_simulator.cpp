@@ -0,0 +1,196 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+/*
+    Replays a trace of logical writes against the mocked backing store, and
+    projects flash lifetime and time spent blocked from the statistics of the
+    wear-leveling layer and the per-element erase counts of the mock.
+
+    The built-in trace models a year of typical use. A recorded trace can be
+    replayed instead by pointing WEAR_LEVELING_TRACE to a console capture of a
+    keyboard built with WEAR_LEVELING_DEBUG_OUTPUT -- every "Write [0xADDR]: XX"
+    line is replayed, anything else is ignored:
+
+        WEAR_LEVELING_TRACE=capture.txt WEAR_LEVELING_TRACE_HOURS=8 .build/test/wear_leveling_simulator.elf
+
+    WEAR_LEVELING_TRACE_HOURS is the time the capture spans (default 24), and
+    WEAR_LEVELING_ENDURANCE the rated erase cycles of the flash (default 10000).
+*/
+
+// Typical STM32F4 embedded flash: 16us per word written, 250ms per 16kB sector erased
+#define SIMULATOR_WRITE_NS 16000
+#define SIMULATOR_ERASE_SECTOR_NS 250000000
+#define SIMULATOR_DEFAULT_ENDURANCE 10000
+#define SIMULATOR_DAYS 365
+
+// Layout of the logical data, following eeconfig and the VIA dynamic keymap
+#define SIMULATOR_DEFAULT_LAYER_ADDR 2
+#define SIMULATOR_KEYMAP_CONFIG_ADDR 4
+#define SIMULATOR_RGB_ADDR 8
+#define SIMULATOR_DYNAMIC_KEYMAP_ADDR 64
+#define SIMULATOR_DYNAMIC_KEYMAP_SIZE (4 * 6 * 15 * 2)
+#define SIMULATOR_VIA_CHUNK_SIZE 28
+
+static std::uint64_t env_or_default(const char* name, std::uint64_t fallback) {
+    const char* value = getenv(name);
+    return (value && *value) ? strtoull(value, nullptr, 10) : fallback;
+}
+
+class WearLevelingSimulator : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        MockBackingStore::Instance().set_write_timing(SIMULATOR_WRITE_NS, SIMULATOR_ERASE_SECTOR_NS);
+        wear_leveling_init();
+        random_state = 1;
+        max_stall_ms = 0;
+    }
+
+    std::uint32_t random_state;
+    std::uint32_t max_stall_ms;
+
+    // Deterministic xorshift32 generator, so that every run replays the same trace
+    std::uint32_t next_random(void) {
+        random_state ^= random_state << 13;
+        random_state ^= random_state >> 17;
+        random_state ^= random_state << 5;
+        return random_state;
+    }
+
+    void write(uint32_t address, const void* value, size_t length) {
+        wear_leveling_statistics_t before;
+        wear_leveling_statistics_t after;
+        wear_leveling_get_statistics(&before);
+        EXPECT_NE(wear_leveling_write(address, value, length), WEAR_LEVELING_FAILED) << "Write failed at address " << address;
+        wear_leveling_task();
+        wear_leveling_get_statistics(&after);
+        max_stall_ms = std::max(max_stall_ms, after.blocked_ms - before.blocked_ms);
+    }
+
+    void rgb_hue_steps(int steps) {
+        std::uint8_t rgb[4];
+        wear_leveling_read(SIMULATOR_RGB_ADDR, rgb, sizeof(rgb));
+        for (int i = 0; i < steps; ++i) {
+            rgb[1] += 8; // RGBLIGHT_HUE_STEP
+            write(SIMULATOR_RGB_ADDR, rgb, sizeof(rgb));
+        }
+    }
+
+    void via_keymap_update(void) {
+        std::uint8_t keymap[SIMULATOR_DYNAMIC_KEYMAP_SIZE];
+        wear_leveling_read(SIMULATOR_DYNAMIC_KEYMAP_ADDR, keymap, sizeof(keymap));
+        for (int i = 0; i < 8; ++i) {
+            keymap[(next_random() % (sizeof(keymap) / 2)) * 2] = (std::uint8_t)next_random();
+        }
+        // The whole keymap is sent by the host, chunks without changes are skipped
+        for (size_t offset = 0; offset < sizeof(keymap); offset += SIMULATOR_VIA_CHUNK_SIZE) {
+            write(SIMULATOR_DYNAMIC_KEYMAP_ADDR + offset, &keymap[offset], std::min<size_t>(SIMULATOR_VIA_CHUNK_SIZE, sizeof(keymap) - offset));
+        }
+    }
+
+    void report(double days) {
+        auto&                      inst = MockBackingStore::Instance();
+        wear_leveling_statistics_t stats;
+        wear_leveling_get_statistics(&stats);
+
+        std::size_t max_erases = 0;
+        for (auto it = inst.storage_begin(); it != inst.storage_end(); ++it) {
+            max_erases = std::max(max_erases, it->num_erases());
+        }
+
+        const double endurance      = env_or_default("WEAR_LEVELING_ENDURANCE", SIMULATOR_DEFAULT_ENDURANCE);
+        const double erases_per_day = max_erases / days;
+        RecordProperty("writes_per_day", std::to_string(stats.writes / days));
+        RecordProperty("bytes_logged_per_day", std::to_string(stats.bytes_logged / days));
+        RecordProperty("consolidations_per_day", std::to_string(stats.consolidations / days));
+        RecordProperty("erase_cycles_per_day", std::to_string(erases_per_day));
+        RecordProperty("projected_lifetime_years", erases_per_day > 0 ? std::to_string(endurance / erases_per_day / 365) : std::string("inf"));
+        RecordProperty("stall_ms_per_day", std::to_string(stats.blocked_ms / days));
+        RecordProperty("max_stall_ms", std::to_string(max_stall_ms));
+    }
+};
+
+/**
+ * Replays a year of RGB hue adjustments, default layer changes and weekly VIA keymap edits.
+ */
+TEST_F(WearLevelingSimulator, BuiltInTrace) {
+    for (int day = 0; day < SIMULATOR_DAYS; ++day) {
+        int bursts = 10 + next_random() % 20;
+        for (int i = 0; i < bursts; ++i) {
+            rgb_hue_steps(1 + next_random() % 12);
+        }
+
+        for (int i = next_random() % 3; i > 0; --i) {
+            std::uint8_t layer = 1 << (next_random() % 4);
+            write(SIMULATOR_DEFAULT_LAYER_ADDR, &layer, sizeof(layer));
+        }
+
+        if (next_random() % 7 == 0) {
+            std::uint16_t keymap_config = next_random();
+            write(SIMULATOR_KEYMAP_CONFIG_ADDR, &keymap_config, sizeof(keymap_config));
+        }
+
+        if (day % 7 == 0) {
+            via_keymap_update();
+        }
+    }
+
+    wear_leveling_statistics_t stats;
+    wear_leveling_get_statistics(&stats);
+    EXPECT_GT(stats.consolidations, 0) << "Trace did not fill the write log";
+    report(SIMULATOR_DAYS);
+}
+
+/**
+ * Replays the writes of a console capture, see above.
+ */
+TEST_F(WearLevelingSimulator, RecordedTrace) {
+    const char* path = getenv("WEAR_LEVELING_TRACE");
+    if (!path || !*path) {
+        GTEST_SKIP() << "WEAR_LEVELING_TRACE not set";
+    }
+
+    std::ifstream trace(path);
+    ASSERT_TRUE(trace.is_open()) << "Could not open " << path;
+
+    std::string line;
+    std::size_t replayed = 0;
+    while (std::getline(trace, line)) {
+        size_t marker = line.find("Write [0x");
+        if (marker == std::string::npos) {
+            continue;
+        }
+
+        unsigned int address;
+        int          consumed;
+        if (sscanf(line.c_str() + marker, "Write [0x%x]:%n", &address, &consumed) != 1) {
+            continue;
+        }
+
+        std::uint8_t data[WEAR_LEVELING_LOGICAL_SIZE];
+        size_t       length = 0;
+        const char*  p      = line.c_str() + marker + consumed;
+        unsigned int byte;
+        int          n;
+        while (length < sizeof(data) && sscanf(p, " %2x%n", &byte, &n) == 1) {
+            data[length++] = (std::uint8_t)byte;
+            p += n;
+        }
+        if (length > 0 && address + length <= WEAR_LEVELING_LOGICAL_SIZE) {
+            write(address, data, length);
+            ++replayed;
+        }
+    }
+    ASSERT_GT(replayed, 0) << "No writes found in " << path;
+
+    RecordProperty("replayed_writes", std::to_string(replayed));
+    report(env_or_default("WEAR_LEVELING_TRACE_HOURS", 24) / 24.0);
+}
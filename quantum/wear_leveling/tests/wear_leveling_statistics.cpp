@@ -0,0 +1,134 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+#define TEST_SECTOR_COUNT 4
+
+class WearLevelingStatistics : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        MockBackingStore::Instance().set_sector_count(TEST_SECTOR_COUNT);
+        wear_leveling_init();
+        next_value = 0x40;
+    }
+
+    std::uint8_t next_value;
+
+    wear_leveling_statistics_t statistics(void) {
+        wear_leveling_statistics_t statistics;
+        wear_leveling_get_statistics(&statistics);
+        return statistics;
+    }
+
+    // Writes single bytes until data is consolidated into the next bank
+    void fill_log(void) {
+        wear_leveling_status_t status;
+        do {
+            uint8_t value = next_value++;
+            status        = wear_leveling_write(value % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+        } while (status == WEAR_LEVELING_SUCCESS);
+        EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+    }
+};
+
+/**
+ * This test verifies that writes and the log entries they produce are counted.
+ */
+TEST_F(WearLevelingStatistics, WritesAreCounted) {
+    auto&   inst  = MockBackingStore::Instance();
+    uint8_t value = 0x12;
+
+    auto writes = inst.total_write_count();
+    EXPECT_EQ(wear_leveling_write(3, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_write(3, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Unchanged write returned incorrect status";
+
+    auto stats = statistics();
+    EXPECT_EQ(stats.writes, 1) << "Write was not counted";
+    EXPECT_EQ(stats.skipped_writes, 1) << "Unchanged write was not counted";
+    EXPECT_EQ(stats.log_entries, 1) << "Log entry was not counted";
+    EXPECT_EQ(stats.bytes_logged, (inst.total_write_count() - writes) * BACKING_STORE_WRITE_SIZE) << "Invalid number of bytes logged";
+    EXPECT_EQ(stats.consolidations, 0) << "No consolidation should have occurred";
+}
+
+/**
+ * This test verifies that consolidations and the sectors erased to make room for them are counted.
+ */
+TEST_F(WearLevelingStatistics, ConsolidationsAreCounted) {
+    auto& inst = MockBackingStore::Instance();
+    for (int i = 0; i < 3; ++i) {
+        fill_log();
+        for (int j = 0; j < TEST_SECTOR_COUNT; ++j) {
+            wear_leveling_task();
+        }
+    }
+
+    auto stats = statistics();
+    EXPECT_EQ(stats.consolidations, 3) << "Invalid number of consolidations";
+    EXPECT_EQ(stats.erases, inst.erase_sector_invoke_count()) << "Invalid number of erased sectors";
+    EXPECT_EQ(stats.log_entries, stats.writes) << "Every single byte write should take one log entry";
+}
+
+/**
+ * This test verifies that the statistics are persisted with each consolidation, whichever bank it went to.
+ */
+TEST_F(WearLevelingStatistics, StatisticsArePersisted) {
+    for (int i = 0; i < 3; ++i) {
+        fill_log();
+        auto stats = statistics();
+
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+        auto reloaded = statistics();
+        // The time spent in the consolidating write itself is only known once it has been persisted
+        EXPECT_LE(reloaded.blocked_ms, stats.blocked_ms) << "Invalid time spent blocked after re-initialisation";
+        reloaded.blocked_ms = stats.blocked_ms;
+        EXPECT_EQ(memcmp(&stats, &reloaded, sizeof(stats)), 0) << "Statistics did not survive re-initialisation";
+    }
+
+    // Anything after the last consolidation is only held in RAM
+    auto    stats = statistics();
+    uint8_t value = 0x12;
+    wear_leveling_write(3, &value, sizeof(value));
+    EXPECT_EQ(statistics().writes, stats.writes + 1) << "Write was not counted";
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(statistics().writes, stats.writes) << "Statistics were persisted without consolidation";
+}
+
+/**
+ * This test verifies that the time spent in the backing store is attributed to the calls that were blocked by it.
+ */
+TEST_F(WearLevelingStatistics, BlockedTimeIsTracked) {
+    auto& inst = MockBackingStore::Instance();
+    inst.set_write_timing(100000, 20000000);
+
+    auto start = inst.time_ns();
+    fill_log();
+    for (int j = 0; j < TEST_SECTOR_COUNT; ++j) {
+        wear_leveling_task();
+    }
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase failed";
+
+    // Initialisation isn't accounted for
+    auto stats = statistics();
+    EXPECT_EQ(stats.blocked_ms, inst.time_ns() / 1000000 - start / 1000000) << "Invalid time spent blocked";
+    EXPECT_EQ(stats.erases, inst.erase_sector_invoke_count() + TEST_SECTOR_COUNT) << "Full erase did not count every sector";
+}
+
+/**
+ * This test verifies that calls blocked for less than a millisecond each still add up to the total time spent.
+ */
+TEST_F(WearLevelingStatistics, ShortBlockedCallsAddUp) {
+    auto& inst = MockBackingStore::Instance();
+    inst.set_write_timing(250000, 20000000);
+
+    auto start = inst.time_ns();
+    for (uint8_t i = 0; i < 8; ++i) {
+        uint8_t value = 0x80 + i;
+        EXPECT_EQ(wear_leveling_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        // The rest of the main loop iteration, so that no write crosses a millisecond boundary
+        inst.advance_clock(1000000 - (inst.clock_ns() % 1000000));
+    }
+    EXPECT_EQ(statistics().blocked_ms, (inst.time_ns() - start) / 1000000) << "Short blocked calls were not added up";
+}
@@ -5,6 +5,13 @@
 #include "wear_leveling.h"
 #include "wear_leveling_internal.h"
 
+#ifdef WEAR_LEVELING_STATISTICS
+#    include "timer.h"
+#    ifdef PROTOCOL_CHIBIOS
+#        include <ch.h>
+#    endif // PROTOCOL_CHIBIOS
+#endif // WEAR_LEVELING_STATISTICS
+
 /*
     This wear leveling algorithm is adapted from algorithms from previous
     implementations in QMK, namely:
@@ -61,12 +68,20 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_BANK_COUNT: The number of banks the backing store is
+            split into, each holding consolidated data and a write log. Every
+            bank needs to be made up of whole sectors of the backing store, and
+            must be at least twice the size of the logical size.
+
     General algorithm:
 
         During initialization:
             * The contents of the consolidated data section are read into cache.
             * The contents of the write log are "played back" and update the
-                cache accordingly.
+                cache accordingly. The log is read in blocks, starting at the
+                size of a single entry and doubling up to
+                WEAR_LEVELING_PLAYBACK_BLOCK_SIZE bytes. Playback stops at the
+                first empty slot -- the rest of the log isn't read at all.
 
         During reads:
             * Logical data is served from the cache.
@@ -76,12 +91,44 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        With WEAR_LEVELING_BACKGROUND_CONSOLIDATION, which requires multiple
+        banks, a full log doesn't consolidate in-line:
+            * wear_leveling_task() erases one sector of the bank being
+                consolidated into per call, then writes one chunk of the cache
+                per call, hashing the chunks as they're written.
+            * Writes in the meantime update the cache. Chunks modified after
+                they were written are marked as dirty, and appended to the new
+                write log once the consolidated data is complete.
+            * Consolidation is scheduled once the log is down to its last
+                WEAR_LEVELING_CONSOLIDATION_RESERVE bytes. Writes in the
+                meantime are appended to the reserved part of the current log
+                as well, as long as they're guaranteed to fit, so they survive
+                a power loss before consolidation completes. Anything past that
+                is only held in RAM until then.
+
+        With WEAR_LEVELING_BANK_COUNT > 1, consolidation targets the next bank:
+            * wear_leveling_task() erases the next bank while the current one
+                is in use, so consolidation only writes to the backing store.
+                Erasures are spread evenly across all banks as a result.
+            * Erasing only starts once the write log is down to its last
+                WEAR_LEVELING_ERASE_AHEAD bytes. Which sectors have been erased
+                isn't persisted, so starting any earlier would erase the next
+                bank again after every startup, regardless of any writes.
+            * Each bank has a generation, incremented whenever data is
+                consolidated into the next bank. During initialization, the
+                newest bank with a valid hash is used -- if power is lost while
+                consolidating, the previous bank and its write log are intact.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
         of the consolidated data area, in an attempt to detect and guard against
         any data corruption.
 
+        With multiple banks, the hash is followed by the 8-byte generation of
+        the bank, which is covered by the hash as well. The hash is written
+        last, so that a bank is only considered valid once completely written.
+
         The write log follows the hash:
 
         Given that the algorithm needs to cater for 2-, 4-, and 8-byte writes,
@@ -153,17 +200,127 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    4- and 8-byte backing store optimizations:
+
+        Only the bytes which differ from the cache are logged. Changed bytes
+        separated by fewer unchanged bytes than the 3-byte header of a
+        multi-byte entry are logged together, as are any changes past the
+        first WEAR_LEVELING_DELTA_MAX_RUNS runs of changed bytes.
+
+        Compact entries encode common updates in a single backing store write
+        operation, where a multi-byte entry would take two (4-byte) or several
+        (8-byte).
+
+        A 16-bit value, such as a dynamic keymap keycode, is encoded in a single
+        4-byte write for the first 4kB of logical data:
+
+        ╔ Word-Entry (4-byte) ══════════════╗
+        ║1100YYYY║YYYYYYYY║AAAAAAAA║BBBBBBBB║
+        ║    └┬─┘║└──┬───┘║└──┬───┘║└──┬───┘║
+        ║   Add  ║ Address║Value[0]║Value[1]║
+        ╚════════╩════════╩════════╩════════╝
+        0 <= Address <= 0xFFE (4094)
+
+        Runs of identical bytes, such as cleared areas, are encoded with their
+        length -- for up to 256 bytes within the first 4kB of logical data for
+        4-byte writes, and for up to 64kB anywhere for 8-byte writes:
+
+        ╔ Run-Entry (4-byte) ═══════════════╗
+        ║1101YYYY║YYYYYYYY║LLLLLLLL║AAAAAAAA║
+        ║    └┬─┘║└──┬───┘║└──┬───┘║└──┬───┘║
+        ║   Add  ║ Address║Length-1║ Value  ║
+        ╚════════╩════════╩════════╩════════╝
+        ╔ Run-Entry (8-byte) ═══════════════════════════════════════════════════╗
+        ║11010YYY║YYYYYYYY║YYYYYYYY║LLLLLLLL║LLLLLLLL║AAAAAAAA║00000000║00000000║
+        ║     └┬┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║        ║        ║
+        ║    Add ║ Address║ Address║Length-1║Length-1║ Value  ║        ║        ║
+        ╚════════╩════════╩════════╩════════╩════════╩════════╩════════╩════════╝
+
+        Single changed bytes and bit flips take a single write operation as a
+        multi-byte entry already, so don't have a compact encoding of their
+        own. */
 
 /**
  * Storage area for the wear-leveling cache.
  */
 static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
-    uint32_t                                                       write_address;
+    uint32_t                                                       write_address;  // Relative to the start of the current bank
+    uint64_t                                                       generation;     // Generation of the current bank
+    size_t                                                         bank_sectors;   // Number of erasable sectors making up each bank
+    size_t                                                         erased_sectors; // Number of sectors of the next bank erased since startup or the last bank switch
+    uint8_t                                                        bank;
     bool                                                           unlocked;
 } wear_leveling;
 
+#if WEAR_LEVELING_BANK_COUNT > 1
+#    define WEAR_LEVELING_BANK_HEADER_SIZE 16 // FNV1a_64 of the consolidated area, followed by the generation of the bank
+#else
+#    define WEAR_LEVELING_BANK_HEADER_SIZE 8 // FNV1a_64 of the consolidated area
+#endif // WEAR_LEVELING_BANK_COUNT > 1
+
+#ifdef WEAR_LEVELING_STATISTICS
+#    define WEAR_LEVELING_HEADER_SIZE (WEAR_LEVELING_BANK_HEADER_SIZE + sizeof(wear_leveling_statistics_t)) // Followed by the statistics as of the consolidation
+
+_Static_assert(sizeof(wear_leveling_statistics_t) % 8 == 0, "Wear leveling statistics need to be a multiple of 8 bytes, to fit any backing store write size");
+
+/**
+ * Statistics of the wear-leveling layer, since the backing store was first used.
+ */
+static wear_leveling_statistics_t __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) wear_leveling_statistics;
+
+/**
+ * Time spent blocked which doesn't add up to a whole millisecond yet.
+ */
+static uint32_t wear_leveling_blocked_us;
+
+#    define wl_stat_add(field, value) (wear_leveling_statistics.field += (value))
+#    define WEAR_LEVELING_CURRENT_STATISTICS (&wear_leveling_statistics)
+#else
+#    define WEAR_LEVELING_HEADER_SIZE WEAR_LEVELING_BANK_HEADER_SIZE
+#    define wl_stat_add(...) \
+        do {                 \
+        } while (0)
+#    define WEAR_LEVELING_CURRENT_STATISTICS NULL
+#endif // WEAR_LEVELING_STATISTICS
+
+#define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + WEAR_LEVELING_HEADER_SIZE)
+
+#if WEAR_LEVELING_BANK_COUNT > 1 && !defined(WEAR_LEVELING_ERASE_AHEAD)
+/**
+ * Space left in the write log once wear_leveling_task() starts erasing the next bank.
+ */
+#    define WEAR_LEVELING_ERASE_AHEAD (((WEAR_LEVELING_BANK_SIZE)-WEAR_LEVELING_LOG_START) / 2)
+#endif // WEAR_LEVELING_BANK_COUNT > 1 && !defined(WEAR_LEVELING_ERASE_AHEAD)
+
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+/**
+ * Space at the end of the write log left for writes made while consolidating into the next bank.
+ */
+#    define WEAR_LEVELING_LOG_RESERVE (WEAR_LEVELING_CONSOLIDATION_RESERVE)
+_Static_assert(WEAR_LEVELING_LOG_RESERVE < (WEAR_LEVELING_BANK_SIZE)-WEAR_LEVELING_LOG_START, "Consolidation reserve must be smaller than the write log");
+
+/**
+ * Granularity of the tracking of changes made during a background consolidation.
+ */
+#    define WEAR_LEVELING_DIRTY_BLOCK_SIZE 8
+#    define WEAR_LEVELING_DIRTY_BLOCK_COUNT (((WEAR_LEVELING_LOGICAL_SIZE) + WEAR_LEVELING_DIRTY_BLOCK_SIZE - 1) / WEAR_LEVELING_DIRTY_BLOCK_SIZE)
+
+typedef enum consolidation_phase_t { CONSOLIDATION_IDLE = 0, CONSOLIDATION_ERASING, CONSOLIDATION_WRITING } consolidation_phase_t;
+
+/**
+ * State of the background consolidation.
+ */
+static struct {
+    consolidation_phase_t phase;
+    uint32_t              step; // Number of bytes of consolidated data written
+    uint64_t              hash; // FNV1a_64 of the consolidated data written so far
+    uint8_t               dirty[(WEAR_LEVELING_DIRTY_BLOCK_COUNT + 7) / 8];
+} consolidation;
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+
 /**
  * Locking helper: status
  */
@@ -197,48 +354,281 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
     return STATUS_SUCCESS;
 }
 
+/**
+ * Statistics helper: start of a call which may block on the backing store
+ */
+static inline uint32_t wear_leveling_blocked_begin(void) {
+#ifdef WEAR_LEVELING_STATISTICS
+    return wear_leveling_timer_read_us();
+#else
+    return 0;
+#endif // WEAR_LEVELING_STATISTICS
+}
+
+/**
+ * Statistics helper: end of a call which may block on the backing store. Calls are often shorter than a millisecond,
+ * so they're timed in microseconds, and the remainder is carried over to the next call.
+ */
+static inline void wear_leveling_blocked_end(uint32_t start) {
+#ifdef WEAR_LEVELING_STATISTICS
+    wear_leveling_blocked_us += wear_leveling_timer_read_us() - start;
+    wl_stat_add(blocked_ms, wear_leveling_blocked_us / 1000);
+    wear_leveling_blocked_us %= 1000;
+#else
+    (void)start;
+#endif // WEAR_LEVELING_STATISTICS
+}
+
+/**
+ * Bank helper: translates an offset within a bank to an address in the backing store
+ */
+static inline uint32_t wear_leveling_bank_address(uint8_t bank, uint32_t offset) {
+    return (uint32_t)bank * (WEAR_LEVELING_BANK_SIZE) + offset;
+}
+
+/**
+ * Bank helper: the bank the next consolidation writes to
+ */
+static inline uint8_t wear_leveling_next_bank(void) {
+    return (wear_leveling.bank + 1) % (WEAR_LEVELING_BANK_COUNT);
+}
+
 /**
  * Resets the cache, ensuring the write address is correctly initialised.
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+}
+
+/**
+ * Makes the bank which consolidated data was just written to the current one, with an empty write log.
+ */
+static void wear_leveling_switch_bank(uint8_t bank, uint64_t generation) {
+    wl_dprintf("Switching to bank %d\n", (int)bank);
+    wear_leveling.bank           = bank;
+    wear_leveling.generation     = generation;
+    wear_leveling.write_address  = WEAR_LEVELING_LOG_START;
+    wear_leveling.erased_sectors = 0;
 }
 
+#if WEAR_LEVELING_BANK_COUNT > 1
 /**
- * Reads the consolidated data from the backing store into the cache.
+ * Bank helper: whether wear_leveling_task() should erase the next sector of the next bank ahead of consolidation
+ */
+static inline bool wear_leveling_erase_ahead_pending(void) {
+    return wear_leveling.erased_sectors < wear_leveling.bank_sectors && wear_leveling.write_address + (WEAR_LEVELING_ERASE_AHEAD) >= (WEAR_LEVELING_BANK_SIZE);
+}
+#endif // WEAR_LEVELING_BANK_COUNT > 1
+
+/**
+ * Reads 8 bytes of the bank header from the backing store.
+ */
+static bool wear_leveling_read_u64(uint32_t address, uint64_t *value) {
+    write_log_entry_t entry;
+#if BACKING_STORE_WRITE_SIZE == 2
+    bool ok = backing_store_read_bulk(address, entry.raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    bool ok = backing_store_read_bulk(address, entry.raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    bool ok = backing_store_read(address, &entry.raw64);
+#endif
+    *value = entry.raw64;
+    return ok;
+}
+
+/**
+ * Writes 8 bytes of the bank header to the backing store.
+ */
+static bool wear_leveling_write_u64(uint32_t address, uint64_t value) {
+    write_log_entry_t entry;
+    entry.raw64 = value;
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry.raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry.raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry.raw64);
+#endif
+}
+
+#ifdef WEAR_LEVELING_STATISTICS
+typedef wear_leveling_statistics_t wear_leveling_header_statistics_t;
+#else
+typedef void wear_leveling_header_statistics_t;
+#endif // WEAR_LEVELING_STATISTICS
+
+/**
+ * Completes the FNV1a_64 hash of consolidated data, which also covers the rest of the bank header.
+ */
+static uint64_t wear_leveling_hash_finish(uint64_t hash, uint64_t generation, const wear_leveling_header_statistics_t *statistics) {
+#if WEAR_LEVELING_BANK_COUNT > 1
+    hash = fnv_64a_buf(&generation, sizeof(generation), hash);
+#else
+    (void)generation;
+#endif // WEAR_LEVELING_BANK_COUNT > 1
+#ifdef WEAR_LEVELING_STATISTICS
+    hash = fnv_64a_buf((void *)statistics, sizeof(wear_leveling_statistics_t), hash);
+#else
+    (void)statistics;
+#endif // WEAR_LEVELING_STATISTICS
+    return hash;
+}
+
+/**
+ * Writes the header following the consolidated data of a bank. The hash goes last, as it marks the bank as valid.
+ */
+static bool wear_leveling_write_header(uint8_t bank, uint64_t generation, uint64_t hash) {
+#ifdef WEAR_LEVELING_STATISTICS
+    wl_dprintf("Writing statistics\n");
+    if (!backing_store_write_bulk(wear_leveling_bank_address(bank, (WEAR_LEVELING_LOGICAL_SIZE) + WEAR_LEVELING_BANK_HEADER_SIZE), (backing_store_int_t *)&wear_leveling_statistics, sizeof(wear_leveling_statistics) / sizeof(backing_store_int_t))) {
+        return false;
+    }
+#endif // WEAR_LEVELING_STATISTICS
+#if WEAR_LEVELING_BANK_COUNT > 1
+    wl_dprintf("Writing generation\n");
+    if (!wear_leveling_write_u64(wear_leveling_bank_address(bank, (WEAR_LEVELING_LOGICAL_SIZE) + 8), generation)) {
+        return false;
+    }
+#endif // WEAR_LEVELING_BANK_COUNT > 1
+    wl_dprintf("Writing checksum\n");
+    return wear_leveling_write_u64(wear_leveling_bank_address(bank, (WEAR_LEVELING_LOGICAL_SIZE)), hash);
+}
+
+#if WEAR_LEVELING_BANK_COUNT > 1
+#    ifdef WEAR_LEVELING_SKIP_BLANK_SECTORS
+/**
+ * Checks whether a sector reads back as erased, in which case erasing it again would only add wear.
+ * Only valid for backing stores which can be written to after reading back as erased, i.e. without ECC.
+ */
+static bool wear_leveling_sector_blank(size_t index) {
+    backing_store_int_t buffer[(WEAR_LEVELING_PLAYBACK_BLOCK_SIZE) / (BACKING_STORE_WRITE_SIZE)];
+    const uint32_t      sector_size = (WEAR_LEVELING_BACKING_SIZE) / (wear_leveling.bank_sectors * (WEAR_LEVELING_BANK_COUNT));
+    const uint32_t      end         = (index + 1) * sector_size;
+    for (uint32_t address = index * sector_size; address < end; address += sizeof(buffer)) {
+        const size_t count = (end - address < sizeof(buffer) ? end - address : sizeof(buffer)) / (BACKING_STORE_WRITE_SIZE);
+        if (!backing_store_read_bulk(address, buffer, count)) {
+            return false;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (buffer[i] != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+#    endif // WEAR_LEVELING_SKIP_BLANK_SECTORS
+
+/**
+ * Erases the next sector of the bank the next consolidation writes to.
+ * Pre-condition: the backing store is unlocked.
+ */
+static bool wear_leveling_erase_next_sector(void) {
+    const size_t index = (size_t)wear_leveling_next_bank() * wear_leveling.bank_sectors + wear_leveling.erased_sectors;
+#    ifdef WEAR_LEVELING_SKIP_BLANK_SECTORS
+    if (wear_leveling_sector_blank(index)) {
+        ++wear_leveling.erased_sectors;
+        return true;
+    }
+#    endif // WEAR_LEVELING_SKIP_BLANK_SECTORS
+
+    wl_dprintf("Erasing backing store sector %d\n", (int)index);
+    if (!backing_store_erase_sector(index)) {
+        wl_dprintf("Failed to erase backing store\n");
+        return false;
+    }
+    wl_stat_add(erases, 1);
+
+    ++wear_leveling.erased_sectors;
+    return true;
+}
+#endif // WEAR_LEVELING_BANK_COUNT > 1
+
+/**
+ * Reads the consolidated data of a bank into the cache, and verifies it against its FNV1a_64 hash.
+ */
+static wear_leveling_status_t wear_leveling_read_bank(uint8_t bank, uint64_t generation, bool *valid) {
+    if (!backing_store_read_bulk(wear_leveling_bank_address(bank, 0), (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+        wl_dprintf("Failed to read from backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+
+    const wear_leveling_header_statistics_t *header_statistics = NULL;
+#ifdef WEAR_LEVELING_STATISTICS
+    wear_leveling_statistics_t __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) statistics;
+    wl_dprintf("Reading statistics\n");
+    backing_store_read_bulk(wear_leveling_bank_address(bank, (WEAR_LEVELING_LOGICAL_SIZE) + WEAR_LEVELING_BANK_HEADER_SIZE), (backing_store_int_t *)&statistics, sizeof(statistics) / sizeof(backing_store_int_t));
+    header_statistics = &statistics;
+#endif // WEAR_LEVELING_STATISTICS
+
+    uint64_t expected = wear_leveling_hash_finish(fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT), generation, header_statistics);
+    uint64_t stored;
+    wl_dprintf("Reading checksum\n");
+    wear_leveling_read_u64(wear_leveling_bank_address(bank, (WEAR_LEVELING_LOGICAL_SIZE)), &stored);
+    *valid = stored == expected;
+
+#ifdef WEAR_LEVELING_STATISTICS
+    if (*valid) {
+        memcpy(&wear_leveling_statistics, &statistics, sizeof(statistics));
+    }
+#endif // WEAR_LEVELING_STATISTICS
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Reads the consolidated data from the backing store into the cache, selecting the newest valid bank.
  * Does not consider the write log.
  */
 static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     wl_dprintf("Reading consolidated data\n");
 
+    wear_leveling.bank       = 0;
+    wear_leveling.generation = 0;
+#ifdef WEAR_LEVELING_STATISTICS
+    memset(&wear_leveling_statistics, 0, sizeof(wear_leveling_statistics));
+    wear_leveling_blocked_us = 0;
+#endif // WEAR_LEVELING_STATISTICS
+
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
-        wl_dprintf("Failed to read from backing store\n");
-        status = WEAR_LEVELING_FAILED;
+    bool                   valid  = false;
+#if WEAR_LEVELING_BANK_COUNT > 1
+    // Try the banks newest first -- if consolidating into a bank was interrupted, the previous one is still intact
+    uint64_t generations[(WEAR_LEVELING_BANK_COUNT)];
+    bool     tried[(WEAR_LEVELING_BANK_COUNT)] = {false};
+    for (uint8_t bank = 0; bank < (WEAR_LEVELING_BANK_COUNT); ++bank) {
+        wear_leveling_read_u64(wear_leveling_bank_address(bank, (WEAR_LEVELING_LOGICAL_SIZE) + 8), &generations[bank]);
     }
+    for (uint8_t attempt = 0; attempt < (WEAR_LEVELING_BANK_COUNT) && !valid && status != WEAR_LEVELING_FAILED; ++attempt) {
+        uint8_t newest = 0;
+        while (tried[newest]) {
+            ++newest;
+        }
+        for (uint8_t bank = newest + 1; bank < (WEAR_LEVELING_BANK_COUNT); ++bank) {
+            if (!tried[bank] && generations[bank] > generations[newest]) {
+                newest = bank;
+            }
+        }
+        tried[newest] = true;
 
-    // Verify the FNV1a_64 result
-    if (status != WEAR_LEVELING_FAILED) {
-        uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
-        write_log_entry_t entry;
-        wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
-        // If we have a mismatch, clear the cache but do not flag a failure,
-        // which will cater for the completely clean MCU case.
-        if (entry.raw64 == expected) {
-            wl_dprintf("Checksum matches, consolidated data is correct\n");
-        } else {
-            wl_dprintf("Checksum mismatch, clearing cache\n");
-            wear_leveling_clear_cache();
+        status = wear_leveling_read_bank(newest, generations[newest], &valid);
+        if (valid) {
+            wear_leveling.bank       = newest;
+            wear_leveling.generation = generations[newest];
         }
     }
+#else
+    status = wear_leveling_read_bank(0, 0, &valid);
+#endif // WEAR_LEVELING_BANK_COUNT > 1
+
+    // If we have a mismatch, clear the cache but do not flag a failure,
+    // which will cater for the completely clean MCU case.
+    if (valid) {
+        wl_dprintf("Checksum matches, consolidated data in bank %d is correct\n", (int)wear_leveling.bank);
+    } else {
+        wl_dprintf("Checksum mismatch, clearing cache\n");
+        wear_leveling_clear_cache();
+    }
 
     // If we failed for any reason, then clear the cache
     if (status == WEAR_LEVELING_FAILED) {
@@ -249,43 +639,31 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
 }
 
 /**
- * Writes the current cache to consolidated data at the beginning of the backing store.
- * Does not clear the write log.
- * Pre-condition: this is just after an erase, so we can write directly without reading.
+ * Writes the current cache to consolidated data at the beginning of the next bank, and switches to it.
+ * Pre-condition: the next bank has just been erased, so we can write directly without reading.
  */
 static wear_leveling_status_t wear_leveling_write_consolidated(void) {
     wl_dprintf("Writing consolidated data\n");
 
+    const uint8_t               bank        = wear_leveling_next_bank();
+    const uint64_t              generation  = wear_leveling.generation + 1;
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     wear_leveling_status_t      status      = WEAR_LEVELING_CONSOLIDATED;
-    if (!backing_store_write_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_write_bulk(wear_leveling_bank_address(bank, 0), (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to write to backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
 
     if (status != WEAR_LEVELING_FAILED) {
-        // Write out the FNV1a_64 result of the consolidated data
-        write_log_entry_t entry;
-        entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
-        wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        // Write out the FNV1a_64 result of the consolidated data, the statistics persisted with it already include this consolidation
+        wl_stat_add(consolidations, 1);
+        if (!wear_leveling_write_header(bank, generation, wear_leveling_hash_finish(fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT), generation, WEAR_LEVELING_CURRENT_STATISTICS))) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    if (status != WEAR_LEVELING_FAILED) {
+        wear_leveling_switch_bank(bank, generation);
     }
 
     if (lock_status == STATUS_SUCCESS) {
@@ -300,10 +678,27 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
  * During this operation, there is the potential for data loss if a power loss occurs.
  */
 static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+#if WEAR_LEVELING_BANK_COUNT > 1
+    wl_dprintf("Erasing next bank\n");
+
+    // Usually wear_leveling_task() has already erased the next bank, finish off whatever's left otherwise.
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    bool                        ok          = lock_status != STATUS_FAILURE;
+    while (ok && wear_leveling.erased_sectors < wear_leveling.bank_sectors) {
+        ok = wear_leveling_erase_next_sector();
+    }
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+#else
     wl_dprintf("Erasing backing store\n");
 
     // Erase the backing store. Expectation is that any un-written values that are read back after this call come back as zero.
     bool ok = backing_store_erase();
+    if (ok) {
+        wl_stat_add(erases, wear_leveling.bank_sectors);
+    }
+#endif // WEAR_LEVELING_BANK_COUNT > 1
     if (!ok) {
         wl_dprintf("Failed to erase backing store\n");
         return WEAR_LEVELING_FAILED;
@@ -315,8 +710,10 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
         wl_dprintf("Failed to write consolidated data\n");
     }
 
-    // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+#if WEAR_LEVELING_BANK_COUNT == 1
+    // Next write of the log occurs after the consolidated values at the start of the backing store, which has been erased regardless.
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+#endif // WEAR_LEVELING_BANK_COUNT == 1
 
     return status;
 }
@@ -329,9 +726,17 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    // Leave it to wear_leveling_task(), the cache holds everything that didn't make it into the log
+    if (wear_leveling.write_address + WEAR_LEVELING_LOG_RESERVE >= (WEAR_LEVELING_BANK_SIZE) && consolidation.phase == CONSOLIDATION_IDLE) {
+        wl_dprintf("Write log full, scheduling consolidation\n");
+        consolidation.phase = CONSOLIDATION_ERASING;
+    }
+#else
+    if (wear_leveling.write_address >= (WEAR_LEVELING_BANK_SIZE)) {
         return wear_leveling_consolidate_force();
     }
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
 
     return WEAR_LEVELING_SUCCESS;
 }
@@ -342,12 +747,20 @@ static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value) {
-    bool ok = backing_store_write(wear_leveling.write_address, value);
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    // The log filled up part way through a write, the rest is written out by the pending consolidation
+    if (wear_leveling.write_address >= (WEAR_LEVELING_BANK_SIZE)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+
+    bool ok = backing_store_write(wear_leveling_bank_address(wear_leveling.bank, wear_leveling.write_address), value);
     if (!ok) {
         wl_dprintf("Failed to write to backing store\n");
         return WEAR_LEVELING_FAILED;
     }
     wear_leveling.write_address += (BACKING_STORE_WRITE_SIZE);
+    wl_stat_add(bytes_logged, (BACKING_STORE_WRITE_SIZE));
     return wear_leveling_consolidate_if_needed();
 }
 
@@ -362,6 +775,7 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
     for (size_t i = 0; i < length; ++i) {
         log.raw8[3 + i] = p[i];
     }
+    wl_stat_add(log_entries, 1);
 
     // Write to the backing store. See the multi-byte log format in the documentation header at the top of the file.
     wear_leveling_status_t status;
@@ -410,6 +824,63 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
     return status;
 }
 
+#if BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
+#    if BACKING_STORE_WRITE_SIZE == 4
+#        define WEAR_LEVELING_COMPACT_RUN_MIN_BYTES 2 // Anything longer than a single byte takes two writes as a multi-byte entry
+#    else
+#        define WEAR_LEVELING_COMPACT_RUN_MIN_BYTES (LOG_ENTRY_MULTIBYTE_MAX_BYTES + 1) // Anything shorter fits into a single multi-byte entry
+#    endif
+
+#    define WEAR_LEVELING_DELTA_MIN_GAP 3 // Size of the header of a multi-byte entry
+
+/**
+ * Runs of logical data changed by a write, relative to the start of the write.
+ */
+typedef struct wear_leveling_delta_t {
+    uint8_t count;
+    struct {
+        uint32_t start;
+        uint32_t end;
+    } runs[(WEAR_LEVELING_DELTA_MAX_RUNS)];
+} wear_leveling_delta_t;
+
+/**
+ * Finds the runs of bytes which differ from the cache.
+ * Pre-condition: the cache has not been updated with the written data yet.
+ */
+static void wear_leveling_find_delta(wear_leveling_delta_t *delta, uint32_t address, const uint8_t *value, size_t length) {
+    const uint8_t *cached = &wear_leveling.cache[address];
+    delta->count          = 0;
+    for (uint32_t i = 0; i < length; ++i) {
+        if (value[i] == cached[i]) {
+            continue;
+        }
+
+        // Short gaps cost less than the header of another entry, and anything past the last run is merged into it
+        if (delta->count > 0 && (i - delta->runs[delta->count - 1].end < WEAR_LEVELING_DELTA_MIN_GAP || delta->count == (WEAR_LEVELING_DELTA_MAX_RUNS))) {
+            delta->runs[delta->count - 1].end = i + 1;
+        } else {
+            delta->runs[delta->count].start = i;
+            delta->runs[delta->count].end   = i + 1;
+            ++delta->count;
+        }
+    }
+}
+
+/**
+ * Appends a compact entry, which always takes a single backing store write.
+ */
+static wear_leveling_status_t wear_leveling_append_compact(write_log_entry_t log) {
+    wl_stat_add(log_entries, 1);
+    wl_stat_add(optimized_entries, 1);
+#    if BACKING_STORE_WRITE_SIZE == 4
+    return wear_leveling_append_raw(log.raw32[0]);
+#    else
+    return wear_leveling_append_raw(log.raw64);
+#    endif
+}
+#endif // BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
+
 /**
  * Handles the actual writing of logical data into the write log section of the backing store.
  */
@@ -424,7 +895,9 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
             const uint16_t v = ((uint16_t)p[1]) << 8 | p[0]; // don't just dereference a uint16_t here -- if unaligned it generates faults on some MCUs
             if (v == 0 || v == 1) {
                 const write_log_entry_t log = LOG_ENTRY_MAKE_WORD_01(address, v);
-                status                      = wear_leveling_append_raw(log.raw16[0]);
+                wl_stat_add(log_entries, 1);
+                wl_stat_add(optimized_entries, 1);
+                status = wear_leveling_append_raw(log.raw16[0]);
                 if (status != WEAR_LEVELING_SUCCESS) {
                     // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                     // If a failure occurred, pass it on.
@@ -441,7 +914,9 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
         // Small-write optimizations - address<64:
         if (address < 64) {
             const write_log_entry_t log = LOG_ENTRY_MAKE_OPTIMIZED_64(address, *p);
-            status                      = wear_leveling_append_raw(log.raw16[0]);
+            wl_stat_add(log_entries, 1);
+            wl_stat_add(optimized_entries, 1);
+            status = wear_leveling_append_raw(log.raw16[0]);
             if (status != WEAR_LEVELING_SUCCESS) {
                 // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                 // If a failure occurred, pass it on.
@@ -453,7 +928,45 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
             p++;
             continue;
         }
-#endif // BACKING_STORE_WRITE_SIZE == 2
+#elif BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
+        // Small-write optimizations - runs of identical bytes:
+        if (address <= LOG_ENTRY_COMPACT_MAX_ADDRESS) {
+            size_t run = 1;
+            while (run < remaining && run < LOG_ENTRY_COMPACT_RUN_MAX_BYTES && p[run] == p[0]) {
+                ++run;
+            }
+            if (run >= WEAR_LEVELING_COMPACT_RUN_MIN_BYTES) {
+                status = wear_leveling_append_compact(LOG_ENTRY_MAKE_COMPACT_RUN(address, run, *p));
+                if (status != WEAR_LEVELING_SUCCESS) {
+                    // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
+                    // If a failure occurred, pass it on.
+                    return status;
+                }
+
+                remaining -= run;
+                address += (uint32_t)run;
+                p += run;
+                continue;
+            }
+        }
+
+#    if BACKING_STORE_WRITE_SIZE == 4
+        // Small-write optimizations - uint16_t, address < 4095. Anything longer takes as many writes with multi-byte entries.
+        if (remaining == 2 && address + 1 <= LOG_ENTRY_COMPACT_MAX_ADDRESS) {
+            status = wear_leveling_append_compact(LOG_ENTRY_MAKE_COMPACT_WORD(address, p[0], p[1]));
+            if (status != WEAR_LEVELING_SUCCESS) {
+                // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
+                // If a failure occurred, pass it on.
+                return status;
+            }
+
+            remaining -= 2;
+            address += 2;
+            p += 2;
+            continue;
+        }
+#    endif // BACKING_STORE_WRITE_SIZE == 4
+#endif     // BACKING_STORE_WRITE_SIZE == 2
         const size_t this_length = remaining >= LOG_ENTRY_MULTIBYTE_MAX_BYTES ? LOG_ENTRY_MULTIBYTE_MAX_BYTES : remaining;
         status                   = wear_leveling_write_raw_multibyte(address, p, this_length);
         if (status != WEAR_LEVELING_SUCCESS) {
@@ -469,18 +982,69 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+#if BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
+/**
+ * Writes the runs of changed logical data into the write log.
+ */
+static wear_leveling_status_t wear_leveling_write_delta(const wear_leveling_delta_t *delta, uint32_t address, const uint8_t *value) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (uint8_t i = 0; i < delta->count && status == WEAR_LEVELING_SUCCESS; ++i) {
+        // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
+        status = wear_leveling_write_raw(address + delta->runs[i].start, &value[delta->runs[i].start], delta->runs[i].end - delta->runs[i].start);
+    }
+    return status;
+}
+#endif // BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
+
+/**
+ * Buffered reader for the write log of the current bank, reading from the backing store a block at a time.
+ * Reads start out at the size of a single log entry and double up to the block size, so that a mostly empty log
+ * doesn't pay for reading a whole block.
+ */
+typedef struct wear_leveling_log_reader_t {
+    backing_store_int_t buffer[(WEAR_LEVELING_PLAYBACK_BLOCK_SIZE) / (BACKING_STORE_WRITE_SIZE)];
+    uint32_t            address;    // Offset of the start of the buffer within the bank
+    uint32_t            length;     // Number of bytes held by the buffer
+    uint32_t            read_ahead; // Number of bytes to read on the next refill
+} wear_leveling_log_reader_t;
+
+/**
+ * Reads a single value of the write log, refilling the buffer of the reader if needed.
+ */
+static bool wear_leveling_log_read(wear_leveling_log_reader_t *reader, uint32_t address, backing_store_int_t *value) {
+    if (address < reader->address || address >= reader->address + reader->length) {
+        if (address >= (WEAR_LEVELING_BANK_SIZE)) {
+            wl_dprintf("Write log entry extends past the end of the bank\n");
+            return false;
+        }
+
+        // Don't read past the end of the bank
+        reader->address    = address;
+        reader->length     = (WEAR_LEVELING_BANK_SIZE)-address < reader->read_ahead ? (WEAR_LEVELING_BANK_SIZE)-address : reader->read_ahead;
+        reader->read_ahead = reader->read_ahead * 2 < sizeof(reader->buffer) ? reader->read_ahead * 2 : sizeof(reader->buffer);
+        if (!backing_store_read_bulk(wear_leveling_bank_address(wear_leveling.bank, address), reader->buffer, reader->length / (BACKING_STORE_WRITE_SIZE))) {
+            reader->length = 0;
+            return false;
+        }
+    }
+
+    *value = reader->buffer[(address - reader->address) / (BACKING_STORE_WRITE_SIZE)];
+    return true;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
 static wear_leveling_status_t wear_leveling_playback_log(void) {
     wl_dprintf("Playback write log\n");
 
-    wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
-    bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    wear_leveling_log_reader_t reader          = {.address = 0, .length = 0, .read_ahead = sizeof(write_log_entry_t) < (WEAR_LEVELING_PLAYBACK_BLOCK_SIZE) ? sizeof(write_log_entry_t) : (WEAR_LEVELING_PLAYBACK_BLOCK_SIZE)};
+    wear_leveling_status_t     status          = WEAR_LEVELING_SUCCESS;
+    bool                       cancel_playback = false;
+    uint32_t                   address         = WEAR_LEVELING_LOG_START;
+    while (!cancel_playback && address < (WEAR_LEVELING_BANK_SIZE)) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_log_read(&reader, address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -509,7 +1073,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_log_read(&reader, address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -529,7 +1093,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_log_read(&reader, address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -539,7 +1103,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_log_read(&reader, address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -550,7 +1114,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_log_read(&reader, address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -589,6 +1153,37 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 wear_leveling.cache[a + 0] = v;
                 wear_leveling.cache[a + 1] = 0;
             } break;
+#elif BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
+            case LOG_ENTRY_TYPE_COMPACT: {
+                const uint32_t a = LOG_ENTRY_COMPACT_GET_ADDRESS(log);
+                switch (LOG_ENTRY_COMPACT_GET_TYPE(log)) {
+#    if BACKING_STORE_WRITE_SIZE == 4
+                    case LOG_ENTRY_COMPACT_WORD: {
+                        if (a + 2 > (WEAR_LEVELING_LOGICAL_SIZE)) {
+                            cancel_playback = true;
+                            status          = WEAR_LEVELING_FAILED;
+                            break;
+                        }
+
+                        memcpy(&wear_leveling.cache[a], &log.raw8[2], 2);
+                    } break;
+#    endif // BACKING_STORE_WRITE_SIZE == 4
+                    case LOG_ENTRY_COMPACT_RUN: {
+                        const uint32_t l = LOG_ENTRY_COMPACT_RUN_GET_LENGTH(log);
+                        if (a + l > (WEAR_LEVELING_LOGICAL_SIZE)) {
+                            cancel_playback = true;
+                            status          = WEAR_LEVELING_FAILED;
+                            break;
+                        }
+
+                        memset(&wear_leveling.cache[a], LOG_ENTRY_COMPACT_RUN_GET_VALUE(log), l);
+                    } break;
+                    default: {
+                        cancel_playback = true;
+                        status          = WEAR_LEVELING_FAILED;
+                    } break;
+                }
+            } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
             default: {
                 cancel_playback = true;
@@ -611,6 +1206,103 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+/**
+ * Keeps track of logical data changed after it was written out by the pending consolidation.
+ */
+static void wear_leveling_mark_dirty(uint32_t address, size_t length) {
+    if (consolidation.phase != CONSOLIDATION_WRITING) {
+        // Nothing has been written so far
+        return;
+    }
+    for (uint32_t block = address / WEAR_LEVELING_DIRTY_BLOCK_SIZE; block * WEAR_LEVELING_DIRTY_BLOCK_SIZE < address + length && block * WEAR_LEVELING_DIRTY_BLOCK_SIZE < consolidation.step; ++block) {
+        consolidation.dirty[block / 8] |= 1 << (block % 8);
+    }
+}
+
+/**
+ * Whether a write made during the pending consolidation is guaranteed to fit into what's left of the current write log.
+ */
+static bool wear_leveling_log_has_room(size_t length) {
+    // No encoding takes more than two backing store writes per logged byte
+    return wear_leveling.write_address + length * 2 * (BACKING_STORE_WRITE_SIZE) <= (WEAR_LEVELING_BANK_SIZE);
+}
+
+/**
+ * Appends the logical data marked as dirty to the write log.
+ */
+static wear_leveling_status_t wear_leveling_write_dirty(void) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (uint32_t block = 0; block < WEAR_LEVELING_DIRTY_BLOCK_COUNT && status == WEAR_LEVELING_SUCCESS; ++block) {
+        if (consolidation.dirty[block / 8] & (1 << (block % 8))) {
+            uint32_t address = block * WEAR_LEVELING_DIRTY_BLOCK_SIZE;
+            uint32_t length  = (WEAR_LEVELING_LOGICAL_SIZE)-address < WEAR_LEVELING_DIRTY_BLOCK_SIZE ? (WEAR_LEVELING_LOGICAL_SIZE)-address : WEAR_LEVELING_DIRTY_BLOCK_SIZE;
+            status           = wear_leveling_write_raw(address, &wear_leveling.cache[address], length);
+        }
+    }
+    memset(consolidation.dirty, 0, sizeof(consolidation.dirty));
+    return status;
+}
+
+/**
+ * Performs a single step of the pending consolidation: erasing one sector of the next bank, or writing one chunk of consolidated data to it.
+ * Pre-condition: the backing store is unlocked.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_step(void) {
+    switch (consolidation.phase) {
+        case CONSOLIDATION_ERASING: {
+            if (wear_leveling.erased_sectors < wear_leveling.bank_sectors) {
+                if (!wear_leveling_erase_next_sector()) {
+                    return WEAR_LEVELING_FAILED;
+                }
+                if (wear_leveling.erased_sectors < wear_leveling.bank_sectors) {
+                    return WEAR_LEVELING_SUCCESS;
+                }
+            }
+
+            consolidation.phase = CONSOLIDATION_WRITING;
+            consolidation.step  = 0;
+            consolidation.hash  = FNV1A_64_INIT;
+            memset(consolidation.dirty, 0, sizeof(consolidation.dirty));
+            return WEAR_LEVELING_SUCCESS;
+        }
+
+        case CONSOLIDATION_WRITING: {
+            const uint32_t address = consolidation.step;
+            const uint32_t length  = (WEAR_LEVELING_LOGICAL_SIZE)-address < (WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE) ? (WEAR_LEVELING_LOGICAL_SIZE)-address : (WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE);
+            wl_dprintf("Writing consolidated data at 0x%04X\n", (int)address);
+            if (!backing_store_write_bulk(wear_leveling_bank_address(wear_leveling_next_bank(), address), (backing_store_int_t *)&wear_leveling.cache[address], length / sizeof(backing_store_int_t))) {
+                wl_dprintf("Failed to write to backing store\n");
+                return WEAR_LEVELING_FAILED;
+            }
+
+            // The hash covers the data as it was written, later changes are part of the write log instead
+            consolidation.hash = fnv_64a_buf(&wear_leveling.cache[address], length, consolidation.hash);
+            consolidation.step += length;
+            if (consolidation.step < (WEAR_LEVELING_LOGICAL_SIZE)) {
+                return WEAR_LEVELING_SUCCESS;
+            }
+
+            const uint8_t  bank       = wear_leveling_next_bank();
+            const uint64_t generation = wear_leveling.generation + 1;
+            wl_stat_add(consolidations, 1);
+            if (!wear_leveling_write_header(bank, generation, wear_leveling_hash_finish(consolidation.hash, generation, WEAR_LEVELING_CURRENT_STATISTICS))) {
+                return WEAR_LEVELING_FAILED;
+            }
+
+            consolidation.phase = CONSOLIDATION_IDLE;
+            wear_leveling_switch_bank(bank, generation);
+
+            wear_leveling_status_t status = wear_leveling_write_dirty();
+            return status == WEAR_LEVELING_FAILED ? status : WEAR_LEVELING_CONSOLIDATED;
+        }
+
+        default:
+            return WEAR_LEVELING_SUCCESS;
+    }
+}
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+
 /**
  * Wear-leveling initialization
  */
@@ -620,6 +1312,10 @@ wear_leveling_status_t wear_leveling_init(void) {
     // Reset the cache
     wear_leveling_clear_cache();
 
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    consolidation.phase = CONSOLIDATION_IDLE;
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+
     // Initialise the backing store
     if (!backing_store_init()) {
         // If it failed, clear the cache and return with failure
@@ -627,6 +1323,15 @@ wear_leveling_status_t wear_leveling_init(void) {
         return WEAR_LEVELING_FAILED;
     }
 
+    // Banks are erased a sector at a time, so they need to be made up of whole sectors
+    size_t sector_count = backing_store_erase_sector_count();
+    if (sector_count % (WEAR_LEVELING_BANK_COUNT) != 0) {
+        wl_dprintf("Backing store sectors can't be split into banks\n");
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling.bank_sectors   = sector_count / (WEAR_LEVELING_BANK_COUNT);
+    wear_leveling.erased_sectors = 0;
+
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
     wear_leveling_status_t status = wear_leveling_read_consolidated();
     if (status == WEAR_LEVELING_FAILED) {
@@ -646,10 +1351,9 @@ wear_leveling_status_t wear_leveling_init(void) {
 }
 
 /**
- * Wear-leveling erase.
- * Post-condition: any reads from the backing store directly after an erase operation must come back as zero.
+ * Wear-leveling erase, see wear_leveling_erase().
  */
-wear_leveling_status_t wear_leveling_erase(void) {
+static wear_leveling_status_t wear_leveling_erase_impl(void) {
     wl_dprintf("Erase\n");
 
     // Unlock the backing store
@@ -661,7 +1365,22 @@ wear_leveling_status_t wear_leveling_erase(void) {
 
     // Perform the erase
     bool ret = backing_store_erase();
+    if (ret) {
+        wl_stat_add(erases, wear_leveling.bank_sectors * (WEAR_LEVELING_BANK_COUNT));
+    }
     wear_leveling_clear_cache();
+    wear_leveling_switch_bank(0, 0);
+#if WEAR_LEVELING_BANK_COUNT > 1
+    if (ret) {
+        // The next bank has just been erased along with everything else
+        wear_leveling.erased_sectors = wear_leveling.bank_sectors;
+    }
+#endif // WEAR_LEVELING_BANK_COUNT > 1
+
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    // Nothing left to consolidate
+    consolidation.phase = CONSOLIDATION_IDLE;
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
 
     // Lock the backing store if we acquired the lock successfully
     if (lock_status == STATUS_SUCCESS) {
@@ -672,9 +1391,20 @@ wear_leveling_status_t wear_leveling_erase(void) {
 }
 
 /**
- * Writes logical data into the backing store. Skips writes if there are no changes to values.
+ * Wear-leveling erase.
+ * Post-condition: any reads from the backing store directly after an erase operation must come back as zero.
  */
-wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *value, size_t length) {
+wear_leveling_status_t wear_leveling_erase(void) {
+    const uint32_t         blocked_start = wear_leveling_blocked_begin();
+    wear_leveling_status_t status        = wear_leveling_erase_impl();
+    wear_leveling_blocked_end(blocked_start);
+    return status;
+}
+
+/**
+ * Writes logical data into the backing store, see wear_leveling_write().
+ */
+static wear_leveling_status_t wear_leveling_write_impl(const uint32_t address, const void *value, size_t length) {
     wl_assert(address + length <= (WEAR_LEVELING_LOGICAL_SIZE));
     if (address + length > (WEAR_LEVELING_LOGICAL_SIZE)) {
         return WEAR_LEVELING_FAILED;
@@ -685,11 +1415,30 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
 
     // Skip write if there's no change compared to the current cached value
     if (memcmp(value, &wear_leveling.cache[address], length) == 0) {
+        wl_stat_add(skipped_writes, 1);
         return true;
     }
 
+#if BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
+    // Only the changed bytes are logged
+    wear_leveling_delta_t delta;
+    wear_leveling_find_delta(&delta, address, value, length);
+#endif // BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
+
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
+    wl_stat_add(writes, 1);
+
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    // The backing store is being consolidated, the cache is written out once that's done. Log the write to the current bank
+    // as well if there's room, otherwise it's only held in RAM until then.
+    if (consolidation.phase != CONSOLIDATION_IDLE) {
+        wear_leveling_mark_dirty(address, length);
+        if (!wear_leveling_log_has_room(length)) {
+            return WEAR_LEVELING_SUCCESS;
+        }
+    }
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
 
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
@@ -699,7 +1448,11 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     // Perform the actual write
+#if BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
+    wear_leveling_status_t status = wear_leveling_write_delta(&delta, address, value);
+#else
     wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
+#endif // BACKING_STORE_WRITE_SIZE == 4 || BACKING_STORE_WRITE_SIZE == 8
     switch (status) {
         case WEAR_LEVELING_CONSOLIDATED:
         case WEAR_LEVELING_FAILED:
@@ -726,6 +1479,95 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+/**
+ * Writes logical data into the backing store. Skips writes if there are no changes to values.
+ */
+wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *value, size_t length) {
+    const uint32_t         blocked_start = wear_leveling_blocked_begin();
+    wear_leveling_status_t status        = wear_leveling_write_impl(address, value, length);
+    wear_leveling_blocked_end(blocked_start);
+    return status;
+}
+
+#if WEAR_LEVELING_BANK_COUNT > 1
+/**
+ * Performs whatever wear_leveling_task() has pending.
+ * Pre-condition: the backing store is unlocked.
+ */
+static wear_leveling_status_t wear_leveling_task_step(void) {
+#    ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    if (consolidation.phase != CONSOLIDATION_IDLE) {
+        wear_leveling_status_t status = wear_leveling_consolidate_step();
+        if (status == WEAR_LEVELING_FAILED) {
+            // Start over on the next invocation, re-erasing whatever was written so far
+            consolidation.phase          = CONSOLIDATION_ERASING;
+            wear_leveling.erased_sectors = 0;
+        }
+        return status;
+    }
+#    endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+
+    return wear_leveling_erase_next_sector() ? WEAR_LEVELING_SUCCESS : WEAR_LEVELING_FAILED;
+}
+#endif // WEAR_LEVELING_BANK_COUNT > 1
+
+/**
+ * Performs the next step of a pending background consolidation, or erases the next sector of the next bank.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+#if WEAR_LEVELING_BANK_COUNT > 1
+    bool pending = false;
+#    ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    pending |= consolidation.phase != CONSOLIDATION_IDLE;
+#    endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    // Get the next bank ready while the current one is in use, so that consolidation only needs to write to it
+    pending |= wear_leveling_erase_ahead_pending();
+    if (!pending) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Unlock the backing store
+    const uint32_t              blocked_start = wear_leveling_blocked_begin();
+    backing_store_lock_status_t lock_status   = wear_leveling_unlock();
+    wear_leveling_status_t      status        = WEAR_LEVELING_FAILED;
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+    } else {
+        status = wear_leveling_task_step();
+        if (lock_status == STATUS_SUCCESS) {
+            if (wear_leveling_lock() == STATUS_FAILURE) {
+                status = WEAR_LEVELING_FAILED;
+            }
+        }
+    }
+
+    wear_leveling_blocked_end(blocked_start);
+    return status;
+#else
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_BANK_COUNT > 1
+}
+
+/**
+ * Whether a background consolidation is pending.
+ */
+bool wear_leveling_consolidation_pending(void) {
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    return consolidation.phase != CONSOLIDATION_IDLE;
+#else
+    return false;
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+}
+
+#ifdef WEAR_LEVELING_STATISTICS
+/**
+ * Retrieves the wear-leveling statistics.
+ */
+void wear_leveling_get_statistics(wear_leveling_statistics_t *statistics) {
+    memcpy(statistics, &wear_leveling_statistics, sizeof(wear_leveling_statistics));
+}
+#endif // WEAR_LEVELING_STATISTICS
+
 /**
  * Reads logical data from the cache.
  */
@@ -766,3 +1608,31 @@ __attribute__((weak)) bool backing_store_write_bulk(uint32_t address, backing_st
     }
     return true;
 }
+
+/**
+ * Weak implementation of the erasable sector count, drivers able to erase parts of the backing store can implement.
+ */
+__attribute__((weak)) size_t backing_store_erase_sector_count(void) {
+    return 1;
+}
+
+/**
+ * Weak implementation of sector erasure, erasing the whole backing store as a single sector.
+ */
+__attribute__((weak)) bool backing_store_erase_sector(size_t index) {
+    return backing_store_erase();
+}
+
+#ifdef WEAR_LEVELING_STATISTICS
+/**
+ * Weak implementation of the microsecond timer used to time blocking calls, only as fine as the system timer.
+ * Only differences between readings are used, so it may wrap around.
+ */
+__attribute__((weak)) uint32_t wear_leveling_timer_read_us(void) {
+#    ifdef PROTOCOL_CHIBIOS
+    return (uint32_t)TIME_I2US(chVTGetSystemTimeX());
+#    else
+    return timer_read32() * 1000;
+#    endif // PROTOCOL_CHIBIOS
+}
+#endif // WEAR_LEVELING_STATISTICS
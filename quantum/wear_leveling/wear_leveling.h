@@ -1,6 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -52,3 +53,46 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Performs the next step of a pending background consolidation.
+ *
+ * Only used with WEAR_LEVELING_BACKGROUND_CONSOLIDATION, in which case a full write log doesn't consolidate in-line.
+ * Instead, each invocation erases a single sector or writes a single chunk of consolidated data, while writes keep
+ * updating the cache. Writes made in the meantime are appended to the new write log once consolidation completes.
+ *
+ * @return Status of the request, WEAR_LEVELING_CONSOLIDATED once the consolidation completed
+ */
+wear_leveling_status_t wear_leveling_task(void);
+
+/**
+ * Whether a background consolidation is waiting to be completed by wear_leveling_task().
+ *
+ * @return true if consolidation is pending
+ */
+bool wear_leveling_consolidation_pending(void);
+
+#ifdef WEAR_LEVELING_STATISTICS
+/**
+ * @typedef Counters of the work performed by the wear-leveling layer.
+ *
+ * Persisted along with each consolidation, so anything counted after the last consolidation is lost on power loss.
+ */
+typedef struct wear_leveling_statistics_t {
+    uint32_t writes;            //< Writes which changed logical data
+    uint32_t skipped_writes;    //< Writes skipped as the logical data was unchanged
+    uint32_t log_entries;       //< Entries appended to the write log
+    uint32_t bytes_logged;      //< Bytes written to the write log
+    uint32_t optimized_entries; //< Entries using one of the compact encodings
+    uint32_t consolidations;    //< Consolidations of the write log
+    uint32_t erases;            //< Erased backing store sectors, erasing the whole backing store counts every sector
+    uint32_t blocked_ms;        //< Time spent waiting for the backing store during writes, erases and background work
+} wear_leveling_statistics_t;
+
+/**
+ * Retrieves the wear-leveling statistics.
+ *
+ * @param statistics[out] the current counters
+ */
+void wear_leveling_get_statistics(wear_leveling_statistics_t* statistics);
+#endif // WEAR_LEVELING_STATISTICS
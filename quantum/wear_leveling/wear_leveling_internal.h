@@ -61,10 +61,42 @@ typedef uint64_t backing_store_int_t;
         } while (0)
 #endif // WEAR_LEVELING_ASSERTS
 
+#ifndef WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE
+#    define WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE 256
+#endif // WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE
+
+#ifndef WEAR_LEVELING_PLAYBACK_BLOCK_SIZE
+#    define WEAR_LEVELING_PLAYBACK_BLOCK_SIZE 64
+#endif // WEAR_LEVELING_PLAYBACK_BLOCK_SIZE
+
+#ifndef WEAR_LEVELING_BANK_COUNT
+#    define WEAR_LEVELING_BANK_COUNT 1
+#endif // WEAR_LEVELING_BANK_COUNT
+
+#ifndef WEAR_LEVELING_CONSOLIDATION_RESERVE
+#    define WEAR_LEVELING_CONSOLIDATION_RESERVE ((WEAR_LEVELING_LOGICAL_SIZE) / 4)
+#endif // WEAR_LEVELING_CONSOLIDATION_RESERVE
+
+#ifndef WEAR_LEVELING_DELTA_MAX_RUNS
+#    define WEAR_LEVELING_DELTA_MAX_RUNS 4
+#endif // WEAR_LEVELING_DELTA_MAX_RUNS
+
+#define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / (WEAR_LEVELING_BANK_COUNT))
+
 // Compile-time validation of configurable options
 _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
+_Static_assert(WEAR_LEVELING_PLAYBACK_BLOCK_SIZE > 0 && WEAR_LEVELING_PLAYBACK_BLOCK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Playback block size must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_BANK_COUNT > 0 && WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_BANK_COUNT == 0, "Backing size must be a multiple of the bank count");
+_Static_assert(WEAR_LEVELING_BANK_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Bank size must be at least twice the size of the logical size");
+_Static_assert(WEAR_LEVELING_BANK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Bank size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+_Static_assert(WEAR_LEVELING_DELTA_MAX_RUNS > 0, "Delta run count must be at least 1");
+_Static_assert(WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE > 0 && WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Consolidation chunk size must be a multiple of write size");
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+// Consolidating the only bank in the background would leave the backing store without any valid data until it completes
+_Static_assert(WEAR_LEVELING_BANK_COUNT > 1, "Background consolidation requires WEAR_LEVELING_BANK_COUNT to be at least 2");
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
@@ -75,6 +107,11 @@ bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, siz
 bool backing_store_lock(void);
 bool backing_store_read(uint32_t address, backing_store_int_t* value);
 bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
+size_t backing_store_erase_sector_count(void);   // weak implementation already provided (single sector), drivers able to erase parts of the backing store can implement
+bool   backing_store_erase_sector(size_t index); // weak implementation already provided (erases the whole backing store), drivers able to erase parts of the backing store can implement
+
+// Timer used for the statistics, weak implementation already provided (system timer), platforms with a finer timer can implement
+uint32_t wear_leveling_timer_read_us(void);
 
 /**
  * Helper type used to contain a write log entry.
@@ -101,6 +138,9 @@ enum {
     // 0x02 -- 2-byte backing store write optimization: word-encoded 0/1 values
     LOG_ENTRY_TYPE_WORD_01,
 
+    // 0x03 -- 4- and 8-byte backing store write optimizations: compact entries
+    LOG_ENTRY_TYPE_COMPACT,
+
     LOG_ENTRY_TYPES
 };
 
@@ -149,3 +189,64 @@ _Static_assert(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit int
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+/**
+ * Compact log entry sub-type discriminator, only used with 4- and 8-byte backing stores.
+ */
+enum {
+    // 0x00 -- 4-byte backing store: 16-bit value, address < 4095
+    LOG_ENTRY_COMPACT_WORD,
+
+    // 0x01 -- run of identical bytes
+    LOG_ENTRY_COMPACT_RUN,
+
+    LOG_ENTRY_COMPACT_TYPES
+};
+
+_Static_assert(LOG_ENTRY_COMPACT_TYPES <= (1 << 2), "Too many compact log entry types to fit into 2 bits of storage");
+
+#define LOG_ENTRY_COMPACT_GET_TYPE(entry) (((entry).raw8[0] >> 4) & BITMASK_FOR_BITCOUNT(2))
+#define LOG_ENTRY_COMPACT_HEADER(type) ((((uint8_t)LOG_ENTRY_TYPE_COMPACT) << 6) | ((((uint8_t)(type)) & BITMASK_FOR_BITCOUNT(2)) << 4))
+
+#if BACKING_STORE_WRITE_SIZE == 4
+#    define LOG_ENTRY_COMPACT_MAX_ADDRESS 0xFFF
+#    define LOG_ENTRY_COMPACT_RUN_MAX_BYTES 256
+#    define LOG_ENTRY_COMPACT_GET_ADDRESS(entry) (((((uint32_t)((entry).raw8[0])) & BITMASK_FOR_BITCOUNT(4)) << 8) | (entry).raw8[1])
+#    define LOG_ENTRY_COMPACT_RUN_GET_LENGTH(entry) (((uint32_t)((entry).raw8[2])) + 1)
+#    define LOG_ENTRY_COMPACT_RUN_GET_VALUE(entry) ((entry).raw8[3])
+#    define LOG_ENTRY_MAKE_COMPACT_WORD(address, value0, value1)                                                                                        \
+        (write_log_entry_t) {                                                                                                                           \
+            .raw8 = {                                                                                                                                   \
+                [0] = (LOG_ENTRY_COMPACT_HEADER(LOG_ENTRY_COMPACT_WORD) | (((uint8_t)((address) >> 8)) & BITMASK_FOR_BITCOUNT(4))), /* type, address */ \
+                [1] = ((uint8_t)(address)),                                                                                         /* address */       \
+                [2] = ((uint8_t)(value0)),                                                                                          /* value */         \
+                [3] = ((uint8_t)(value1)),                                                                                          /* value */         \
+            }                                                                                                                                           \
+        }
+#    define LOG_ENTRY_MAKE_COMPACT_RUN(address, length, value)                                                                                         \
+        (write_log_entry_t) {                                                                                                                          \
+            .raw8 = {                                                                                                                                  \
+                [0] = (LOG_ENTRY_COMPACT_HEADER(LOG_ENTRY_COMPACT_RUN) | (((uint8_t)((address) >> 8)) & BITMASK_FOR_BITCOUNT(4))), /* type, address */ \
+                [1] = ((uint8_t)(address)),                                                                                        /* address */       \
+                [2] = ((uint8_t)((length)-1)),                                                                                     /* length - 1 */    \
+                [3] = ((uint8_t)(value)),                                                                                          /* value */         \
+            }                                                                                                                                          \
+        }
+#elif BACKING_STORE_WRITE_SIZE == 8
+#    define LOG_ENTRY_COMPACT_MAX_ADDRESS 0x7FFFF
+#    define LOG_ENTRY_COMPACT_RUN_MAX_BYTES 65536
+#    define LOG_ENTRY_COMPACT_GET_ADDRESS(entry) (((((uint32_t)((entry).raw8[0])) & BITMASK_FOR_BITCOUNT(3)) << 16) | (((uint32_t)((entry).raw8[1])) << 8) | (entry).raw8[2])
+#    define LOG_ENTRY_COMPACT_RUN_GET_LENGTH(entry) (((((uint32_t)((entry).raw8[3])) << 8) | (entry).raw8[4]) + 1)
+#    define LOG_ENTRY_COMPACT_RUN_GET_VALUE(entry) ((entry).raw8[5])
+#    define LOG_ENTRY_MAKE_COMPACT_RUN(address, length, value)                                                                                          \
+        (write_log_entry_t) {                                                                                                                           \
+            .raw8 = {                                                                                                                                   \
+                [0] = (LOG_ENTRY_COMPACT_HEADER(LOG_ENTRY_COMPACT_RUN) | (((uint8_t)((address) >> 16)) & BITMASK_FOR_BITCOUNT(3))), /* type, address */ \
+                [1] = ((uint8_t)((address) >> 8)),                                                                                  /* address */       \
+                [2] = ((uint8_t)(address)),                                                                                         /* address */       \
+                [3] = ((uint8_t)(((length)-1) >> 8)),                                                                               /* length - 1 */    \
+                [4] = ((uint8_t)((length)-1)),                                                                                      /* length - 1 */    \
+                [5] = ((uint8_t)(value)),                                                                                           /* value */         \
+            }                                                                                                                                           \
+        }
+#endif // BACKING_STORE_WRITE_SIZE == 4
@@ -0,0 +1,181 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "eeconfig.h"
+#include "eeprom.h"
+#include "keyboard.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+void last_matrix_activity_trigger(void);
+}
+
+class EeconfigStore : public testing::Test {
+   protected:
+    void SetUp() override {
+        eeconfig_init_quantum();
+        timer_clear();
+        last_matrix_activity_trigger();
+    }
+
+    void idle(uint32_t ms) {
+        advance_time(ms);
+        eeconfig_task();
+    }
+};
+
+TEST_F(EeconfigStore, RecordsKeepTheirOffsets) {
+    EXPECT_EQ((uintptr_t)EECONFIG_MAGIC, 0);
+    EXPECT_EQ((uintptr_t)EECONFIG_KEYMAP, 4);
+    EXPECT_EQ((uintptr_t)EECONFIG_RGBLIGHT, 8);
+    EXPECT_EQ((uintptr_t)EECONFIG_HANDEDNESS, 14);
+    EXPECT_EQ((uintptr_t)EECONFIG_USER, 19);
+    EXPECT_EQ((uintptr_t)EECONFIG_RGB_MATRIX, 24);
+    EXPECT_EQ((uintptr_t)EECONFIG_LED_MATRIX, 24);
+    EXPECT_EQ((uintptr_t)EECONFIG_HAPTIC, 32);
+    EXPECT_EQ((uintptr_t)EECONFIG_RGBLIGHT_EXTENDED, 36);
+}
+
+TEST_F(EeconfigStore, UpdatesAreWrittenThrough) {
+    eeconfig_update_default_layer(0x08);
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEFAULT_LAYER), 0x08);
+
+    uint32_t haptic = 0xDEADBEEF;
+    eeconfig_update_record(EECONFIG_RECORD_HAPTIC, &haptic);
+    EXPECT_EQ(eeprom_read_dword(EECONFIG_HAPTIC), 0xDEADBEEF);
+    haptic = 0;
+    eeconfig_read_record(EECONFIG_RECORD_HAPTIC, &haptic);
+    EXPECT_EQ(haptic, 0xDEADBEEF);
+}
+
+TEST_F(EeconfigStore, ReadsAreServedFromRam) {
+    eeconfig_update_debug(0x12);
+    eeprom_write_byte(EECONFIG_DEBUG, 0x34);
+    EXPECT_EQ(eeconfig_read_debug(), 0x12);
+
+    eeconfig_load();
+    EXPECT_EQ(eeconfig_read_debug(), 0x34);
+}
+
+TEST_F(EeconfigStore, BatchedUpdatesAreWrittenAtTheEnd) {
+    eeconfig_batch_begin();
+    eeconfig_update_default_layer(0x04);
+    eeconfig_batch_begin();
+    eeconfig_update_debug(0x56);
+    eeconfig_batch_end();
+
+    // Visible through eeconfig, but not yet in EEPROM
+    EXPECT_EQ(eeconfig_read_debug(), 0x56);
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEBUG), 0x00);
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEFAULT_LAYER), 0x01);
+
+    eeconfig_batch_end();
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEBUG), 0x56);
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEFAULT_LAYER), 0x04);
+}
+
+TEST_F(EeconfigStore, BlocksBeyondTheCoreConfiguration) {
+    uint8_t  data[4] = {0xA1, 0xA2, 0xA3, 0xA4};
+    uint8_t  read[4];
+    uint8_t *addr = (uint8_t *)(EECONFIG_BASE_SIZE - 2);
+
+    eeconfig_update_block(data, addr, sizeof(data));
+    eeprom_read_block(read, addr, sizeof(read));
+    EXPECT_EQ(memcmp(read, data, sizeof(data)), 0);
+
+    // Only the part outside the core configuration is read from EEPROM
+    eeprom_write_byte(addr + 1, 0x00);
+    eeprom_write_byte(addr + 2, 0x00);
+    eeconfig_read_block(read, addr, sizeof(read));
+    EXPECT_EQ(read[1], 0xA2);
+    EXPECT_EQ(read[2], 0x00);
+}
+
+TEST_F(EeconfigStore, DeferredUpdatesWaitForQuietPeriod) {
+    eeconfig_update_keymap(0x1234);
+    EXPECT_EQ(eeconfig_read_keymap(), 0x1234);
+    EXPECT_TRUE(eeconfig_flush_pending());
+
+    // Every further change restarts the quiet period
+    idle(EECONFIG_FLUSH_TIMEOUT - 1);
+    uint32_t haptic = 0x11223344;
+    eeconfig_update_record_deferred(EECONFIG_RECORD_HAPTIC, &haptic);
+    idle(EECONFIG_FLUSH_TIMEOUT - 1);
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x1400);
+    EXPECT_EQ(eeprom_read_dword(EECONFIG_HAPTIC), 0);
+
+    // As does input
+    last_matrix_activity_trigger();
+    idle(EECONFIG_FLUSH_TIMEOUT - 1);
+    EXPECT_TRUE(eeconfig_flush_pending());
+
+    idle(1);
+    EXPECT_FALSE(eeconfig_flush_pending());
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x1234);
+    EXPECT_EQ(eeprom_read_dword(EECONFIG_HAPTIC), 0x11223344);
+}
+
+TEST_F(EeconfigStore, ImmediateUpdatesFlushPendingOnes) {
+    eeconfig_update_keymap(0x4321);
+    eeconfig_update_debug(0x01);
+    EXPECT_FALSE(eeconfig_flush_pending());
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x4321);
+}
+
+TEST_F(EeconfigStore, DeferredBlocksBeyondTheCoreConfiguration) {
+    static uint8_t config[2] = {0x5A, 0xA5};
+    uint8_t       *addr      = (uint8_t *)EECONFIG_BASE_SIZE;
+    eeprom_update_block("\0\0", addr, 2);
+
+    eeconfig_update_block_deferred(config, addr, sizeof(config));
+    EXPECT_EQ(eeprom_read_byte(addr), 0x00);
+
+    // Only a reference is kept, so later changes are written too
+    config[1] = 0x55;
+    eeconfig_update_block_deferred(config, addr, sizeof(config));
+    idle(EECONFIG_FLUSH_TIMEOUT);
+    EXPECT_EQ(eeprom_read_byte(addr), 0x5A);
+    EXPECT_EQ(eeprom_read_byte(addr + 1), 0x55);
+}
+
+TEST_F(EeconfigStore, ConstantActivityOnlyDefersUpToTheMaximum) {
+    eeconfig_update_keymap(0x2468);
+
+    // Input keeps restarting the quiet period
+    for (uint32_t elapsed = 0; elapsed + EECONFIG_FLUSH_TIMEOUT / 2 < EECONFIG_FLUSH_MAX_DELAY; elapsed += EECONFIG_FLUSH_TIMEOUT / 2) {
+        last_matrix_activity_trigger();
+        idle(EECONFIG_FLUSH_TIMEOUT / 2);
+        EXPECT_TRUE(eeconfig_flush_pending());
+    }
+
+    last_matrix_activity_trigger();
+    idle(EECONFIG_FLUSH_TIMEOUT / 2);
+    EXPECT_FALSE(eeconfig_flush_pending());
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x2468);
+}
+
+static int      flush_notifications;
+static uint16_t keymap_at_notification;
+
+static void count_flush_notification(void) {
+    flush_notifications++;
+    keymap_at_notification = eeprom_read_word(EECONFIG_KEYMAP);
+}
+
+TEST_F(EeconfigStore, FlushNotificationsFollowTheWrite) {
+    flush_notifications = 0;
+    eeconfig_update_keymap(0x1357);
+    eeconfig_notify_flush(count_flush_notification);
+    eeconfig_notify_flush(count_flush_notification);
+    EXPECT_EQ(flush_notifications, 0);
+
+    idle(EECONFIG_FLUSH_TIMEOUT);
+    EXPECT_EQ(flush_notifications, 1);
+    EXPECT_EQ(keymap_at_notification, 0x1357);
+
+    idle(EECONFIG_FLUSH_TIMEOUT);
+    EXPECT_EQ(flush_notifications, 1);
+}
@@ -0,0 +1,59 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+static int post_init_calls = 0;
+
+extern "C" void keyboard_post_init_user(void) {
+    post_init_calls++;
+}
+
+class DeferredInit : public TestFixture {};
+
+TEST_F(DeferredInit, KeypressesAreReportedBeforeInitCompletes) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+
+    // keyboard_init() has only brought up what is needed to report keypresses
+    EXPECT_FALSE(keyboard_init_complete());
+    EXPECT_EQ(post_init_calls, 0);
+    EXPECT_NE(keyboard_boot_phase_time(BOOT_PHASE_CRITICAL), BOOT_PHASE_PENDING);
+    EXPECT_EQ(keyboard_boot_phase_time(BOOT_PHASE_FIRST_REPORT), BOOT_PHASE_PENDING);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NE(keyboard_boot_phase_time(BOOT_PHASE_FIRST_SCAN), BOOT_PHASE_PENDING);
+    EXPECT_NE(keyboard_boot_phase_time(BOOT_PHASE_FIRST_REPORT), BOOT_PHASE_PENDING);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The remaining subsystems come up one per scan, keyboard_post_init_kb() last
+    EXPECT_NO_REPORT(driver);
+    for (int i = 0; i < 16 && !keyboard_init_complete(); ++i) {
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(keyboard_init_complete());
+    EXPECT_EQ(post_init_calls, 1);
+    EXPECT_GE(keyboard_boot_phase_time(BOOT_PHASE_COMPLETE), keyboard_boot_phase_time(BOOT_PHASE_FIRST_REPORT));
+
+    run_one_scan_loop();
+    EXPECT_EQ(post_init_calls, 1);
+}
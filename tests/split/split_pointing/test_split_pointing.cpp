@@ -0,0 +1,220 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <deque>
+
+#include "../split_test_fixture.hpp"
+
+extern "C" {
+#include "pointing_device.h"
+#include "serial_loopback.h"
+#include "split_util.h"
+#include "transactions.h"
+}
+
+using testing::_;
+using testing::Invoke;
+
+static std::deque<report_mouse_t> sensor_reports;
+static uint8_t                    sensor_buttons = 0;
+static uint32_t                   sensor_polls   = 0;
+
+// Only polled by the simulated right half
+extern "C" report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
+    sensor_polls++;
+    if (sensor_reports.empty()) {
+        mouse_report = {};
+    } else {
+        mouse_report = sensor_reports.front();
+        sensor_reports.pop_front();
+    }
+    mouse_report.buttons = sensor_buttons;
+    return mouse_report;
+}
+
+static report_mouse_t motion(mouse_xy_report_t x, mouse_xy_report_t y, int8_t h = 0, int8_t v = 0) {
+    report_mouse_t report = {};
+    report.x              = x;
+    report.y              = y;
+    report.h              = h;
+    report.v              = v;
+    return report;
+}
+
+class SplitPointing : public SplitTestFixture {
+   protected:
+    int32_t  sent_x       = 0;
+    int32_t  sent_y       = 0;
+    int32_t  sent_v       = 0;
+    uint8_t  sent_buttons = 0;
+    uint32_t sent_reports = 0;
+
+    void SetUp() override {
+        SplitTestFixture::SetUp();
+        sensor_reports.clear();
+        sensor_buttons = 0;
+        sensor_polls   = 0;
+    }
+
+    void record_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([this](report_mouse_t &report) {
+            sent_x += report.x;
+            sent_y += report.y;
+            sent_v += report.v;
+            sent_buttons = report.buttons;
+            sent_reports++;
+        }));
+    }
+
+    void set_connected(bool connected) {
+        serial_loopback_config_t config = serial_loopback_get_config();
+        config.connected                = connected;
+        set_link(config);
+    }
+};
+
+TEST_F(SplitPointing, MotionIsForwarded) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    record_reports(driver);
+
+    sensor_reports.push_back(motion(5, -3, 0, 1));
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(sent_x, 5);
+    EXPECT_EQ(sent_y, -3);
+    EXPECT_EQ(sent_v, 1);
+    EXPECT_EQ(sent_reports, 1);
+}
+
+TEST_F(SplitPointing, SetSharedReportReplacesPendingMotion) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    record_reports(driver);
+
+    pointing_device_add_shared_motion(200, 0, 0, 0, 0);
+    pointing_device_set_shared_report(motion(4, 2));
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(sent_x, 4);
+    EXPECT_EQ(sent_y, 2);
+    EXPECT_EQ(sent_reports, 1);
+}
+
+TEST_F(SplitPointing, EverySensorReadIsForwarded) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    record_reports(driver);
+
+    int32_t expected_x = 0;
+    int32_t expected_y = 0;
+    for (int i = 0; i < 200; i++) {
+        sensor_reports.push_back(motion(i % 7 - 3, i % 5));
+        expected_x += i % 7 - 3;
+        expected_y += i % 5;
+    }
+    idle_for(250);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(sensor_reports.empty());
+    EXPECT_EQ(sent_x, expected_x);
+    EXPECT_EQ(sent_y, expected_y);
+}
+
+TEST_F(SplitPointing, NoMotionIsLostOnCorruptedTransfers) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    record_reports(driver);
+
+    serial_loopback_config_t config = serial_loopback_get_config();
+    config.bit_error_rate           = 2000;
+    set_link(config);
+
+    for (int i = 0; i < 500; i++) {
+        sensor_reports.push_back(motion(1, -1));
+    }
+    idle_for(600);
+    config.bit_error_rate = 0;
+    set_link(config);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(serial_loopback_get_stats()->corrupted_bits, 0);
+    EXPECT_EQ(sent_x, 500);
+    EXPECT_EQ(sent_y, -500);
+}
+
+TEST_F(SplitPointing, MotionIsAccumulatedWhileDisconnected) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    record_reports(driver);
+
+    set_connected(false);
+    for (int i = 0; i < 40; i++) {
+        sensor_reports.push_back(motion(XY_REPORT_MAX, 1));
+    }
+    idle_for(100);
+    EXPECT_EQ(sent_reports, 0);
+
+    set_connected(true);
+    idle_for(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    // Nothing is lost, it's spread over as many reports as needed
+    EXPECT_EQ(sent_x, 40 * XY_REPORT_MAX);
+    EXPECT_EQ(sent_y, 40);
+    EXPECT_GE(sent_reports, 40);
+}
+
+TEST_F(SplitPointing, AccumulatedMotionSaturates) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    record_reports(driver);
+
+    set_connected(false);
+    for (int i = 0; i < 2 * INT16_MAX / XY_REPORT_MAX + 2; i++) {
+        sensor_reports.push_back(motion(XY_REPORT_MAX, XY_REPORT_MIN));
+    }
+    idle_for(2 * INT16_MAX / XY_REPORT_MAX + 10);
+
+    set_connected(true);
+    idle_for(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(sent_x, INT16_MAX);
+    EXPECT_EQ(sent_y, INT16_MIN);
+}
+
+TEST_F(SplitPointing, ButtonsAreForwarded) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    record_reports(driver);
+
+    sensor_buttons = 1 << POINTING_DEVICE_BUTTON1;
+    idle_for(10);
+    EXPECT_EQ(sent_buttons, 1 << POINTING_DEVICE_BUTTON1);
+
+    sensor_buttons = 0;
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(sent_buttons, 0);
+}
+
+TEST_F(SplitPointing, LinkCostPerScan) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    record_reports(driver);
+
+    const int scans = 100;
+    for (int i = 0; i < scans; i++) {
+        sensor_reports.push_back(motion(1, 1));
+    }
+    serial_loopback_clear_stats();
+    idle_for(scans);
+    VERIFY_AND_CLEAR(driver);
+
+    RecordProperty("bytes_to_master_per_scan", std::to_string((double)serial_loopback_get_stats()->bytes_to_master / scans));
+    record_link_cost(scans);
+}
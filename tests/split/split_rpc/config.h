@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SPLIT_TRANSACTION_IDS_USER RPC_ID_USER_INCREMENT, RPC_ID_USER_COUNT
+#define RPC_MAX_ATTEMPTS 10
@@ -0,0 +1,270 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "../split_test_fixture.hpp"
+
+extern "C" {
+#include "serial_loopback.h"
+#include "split_util.h"
+#include "transactions.h"
+}
+
+using testing::_;
+
+static int executions = 0;
+
+static void increment_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    const uint8_t *in  = (const uint8_t *)in_data;
+    uint8_t       *out = (uint8_t *)out_data;
+    for (uint8_t i = 0; i < out_buflen && i < in_buflen; i++) {
+        out[i] = in[i] + 1;
+    }
+    executions++;
+}
+
+static void count_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    executions++;
+}
+
+struct rpc_result {
+    int     calls   = 0;
+    bool    success = false;
+    uint8_t data[4] = {0};
+};
+
+static void store_result(int8_t transaction_id, bool success, uint8_t target2initiator_buffer_size, const void *target2initiator_buffer, void *context) {
+    rpc_result *result = (rpc_result *)context;
+    result->calls++;
+    result->success = success;
+    if (success) {
+        memcpy(result->data, target2initiator_buffer, target2initiator_buffer_size);
+    }
+}
+
+class SplitRpc : public SplitTestFixture {
+   protected:
+    void SetUp() override {
+        SplitTestFixture::SetUp();
+        executions = 0;
+        transaction_register_rpc(RPC_ID_USER_INCREMENT, increment_slave_handler);
+        transaction_register_rpc(RPC_ID_USER_COUNT, count_slave_handler);
+
+        /* Bring the link up, which also starts the RPC session on the slave. */
+        TestDriver driver;
+        EXPECT_NO_REPORT(driver);
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+    }
+};
+
+TEST_F(SplitRpc, ExecReturnsResponse) {
+    uint8_t request[4]  = {1, 2, 3, 4};
+    uint8_t response[4] = {0};
+
+    serial_loopback_clear_stats();
+    EXPECT_TRUE(transaction_rpc_exec(RPC_ID_USER_INCREMENT, sizeof(request), request, sizeof(response), response));
+
+    EXPECT_EQ(response[0], 2);
+    EXPECT_EQ(response[3], 5);
+    EXPECT_EQ(executions, 1);
+    /* Frame info and the combined request/response frame. */
+    EXPECT_EQ(serial_loopback_get_stats()->transactions, 2);
+}
+
+TEST_F(SplitRpc, ExecRejectsCoreTransactions) {
+    uint8_t request = 0;
+
+    EXPECT_FALSE(transaction_rpc_exec(EXECUTE_RPC, sizeof(request), &request, 0, NULL));
+    EXPECT_FALSE(transaction_rpc_exec(RPC_ID_USER_INCREMENT, RPC_M2S_BUFFER_SIZE + 1, &request, 0, NULL));
+    EXPECT_EQ(executions, 0);
+}
+
+TEST_F(SplitRpc, QueuedRequestsShareOneFrame) {
+    std::vector<rpc_result> results(3);
+    uint8_t                 request[4]  = {9, 9, 9, 9};
+    uint8_t                 response[4] = {0};
+
+    for (uint8_t i = 0; i < results.size(); i++) {
+        uint8_t queued[4] = {i, i, i, i};
+        EXPECT_TRUE(transaction_rpc_exec_async(RPC_ID_USER_INCREMENT, sizeof(queued), queued, sizeof(queued), store_result, &results[i]));
+    }
+    EXPECT_EQ(executions, 0);
+
+    /* The blocking request goes out along with everything queued before it. */
+    serial_loopback_clear_stats();
+    EXPECT_TRUE(transaction_rpc_exec(RPC_ID_USER_INCREMENT, sizeof(request), request, sizeof(response), response));
+
+    EXPECT_EQ(executions, 4);
+    EXPECT_EQ(serial_loopback_get_stats()->transactions, 2);
+    EXPECT_EQ(response[0], 10);
+    for (uint8_t i = 0; i < results.size(); i++) {
+        EXPECT_EQ(results[i].calls, 1);
+        EXPECT_TRUE(results[i].success);
+        EXPECT_EQ(results[i].data[0], i + 1);
+    }
+}
+
+TEST_F(SplitRpc, QueuedRequestsAreSentDuringScan) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    rpc_result result;
+    uint8_t    request[4] = {1, 2, 3, 4};
+
+    EXPECT_TRUE(transaction_rpc_exec_async(RPC_ID_USER_INCREMENT, sizeof(request), request, sizeof(request), store_result, &result));
+    EXPECT_EQ(result.calls, 0);
+
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(result.calls, 1);
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(result.data[3], 5);
+}
+
+TEST_F(SplitRpc, QueueRejectsOverflow) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    std::vector<rpc_result> results(RPC_QUEUE_SIZE + 1);
+
+    for (uint8_t i = 0; i < RPC_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(transaction_rpc_send_async(RPC_ID_USER_COUNT, 0, NULL, store_result, &results[i]));
+    }
+    EXPECT_FALSE(transaction_rpc_send_async(RPC_ID_USER_COUNT, 0, NULL, store_result, &results[RPC_QUEUE_SIZE]));
+
+    run_one_scan_loop();
+
+    EXPECT_EQ(executions, RPC_QUEUE_SIZE);
+    EXPECT_EQ(results[RPC_QUEUE_SIZE].calls, 0);
+}
+
+TEST_F(SplitRpc, LargeRequestsAreSplitAcrossFrames) {
+    uint8_t    request[RPC_M2S_BUFFER_SIZE];
+    rpc_result result;
+
+    memset(request, 0, sizeof(request));
+    EXPECT_TRUE(transaction_rpc_send_async(RPC_ID_USER_COUNT, sizeof(request), request, store_result, &result));
+
+    serial_loopback_clear_stats();
+    EXPECT_TRUE(transaction_rpc_send(RPC_ID_USER_COUNT, sizeof(request), request));
+
+    EXPECT_EQ(executions, 2);
+    EXPECT_EQ(serial_loopback_get_stats()->transactions, 4);
+    EXPECT_TRUE(result.success);
+}
+
+TEST_F(SplitRpc, RetransmittedFramesAreExecutedOnce) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    const int               requests = 40;
+    std::vector<rpc_result> results(requests);
+
+    serial_loopback_config_t config = serial_loopback_get_config();
+    config.bit_error_rate           = 500;
+    config.parity                   = true;
+    set_link(config);
+
+    for (int i = 0; i < requests; i++) {
+        uint8_t request[4] = {0};
+        while (!transaction_rpc_exec_async(RPC_ID_USER_INCREMENT, sizeof(request), request, sizeof(request), store_result, &results[i])) {
+            run_one_scan_loop();
+        }
+    }
+    idle_for(100);
+
+    EXPECT_GT(serial_loopback_get_stats()->failed_transactions, 0);
+    EXPECT_TRUE(is_transport_connected());
+    for (int i = 0; i < requests; i++) {
+        EXPECT_EQ(results[i].calls, 1);
+        EXPECT_TRUE(results[i].success);
+        EXPECT_EQ(results[i].data[0], 1);
+    }
+    EXPECT_EQ(executions, requests);
+}
+
+TEST_F(SplitRpc, RetriedFramesWithAppendedRequestsAreExecutedOnce) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    rpc_result first;
+    rpc_result second;
+    uint8_t    first_request[4]  = {1, 1, 1, 1};
+    uint8_t    second_request[4] = {7, 7, 7, 7};
+
+    /* The slave executes the first request, but its response gets lost. */
+    serial_loopback_drop_responses(EXECUTE_RPC, 1);
+    EXPECT_TRUE(transaction_rpc_exec_async(RPC_ID_USER_INCREMENT, sizeof(first_request), first_request, sizeof(first_request), store_result, &first));
+    run_one_scan_loop();
+    EXPECT_EQ(executions, 1);
+    EXPECT_EQ(first.calls, 0);
+
+    /* The retry carries another request, only that one is executed. */
+    EXPECT_TRUE(transaction_rpc_exec_async(RPC_ID_USER_INCREMENT, sizeof(second_request), second_request, sizeof(second_request), store_result, &second));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(executions, 2);
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_TRUE(first.success);
+    EXPECT_EQ(first.data[0], 2);
+    EXPECT_EQ(second.calls, 1);
+    EXPECT_TRUE(second.success);
+    EXPECT_EQ(second.data[0], 8);
+}
+
+TEST_F(SplitRpc, QueuedRequestsFailOnDisconnect) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    rpc_result result;
+
+    EXPECT_TRUE(transaction_rpc_send_async(RPC_ID_USER_COUNT, 0, NULL, store_result, &result));
+
+    serial_loopback_config_t config = serial_loopback_get_config();
+    config.connected                = false;
+    set_link(config);
+
+    idle_for(1000);
+
+    EXPECT_EQ(result.calls, 1);
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(executions, 0);
+    EXPECT_FALSE(transaction_rpc_send_async(RPC_ID_USER_COUNT, 0, NULL, store_result, &result));
+
+    config.connected = true;
+    set_link(config);
+    idle_for(1000);
+    EXPECT_TRUE(is_transport_connected());
+}
+
+TEST_F(SplitRpc, LinkCostPerRequest) {
+    const int requests    = 64;
+    uint8_t   request[4]  = {0};
+    uint8_t   response[4] = {0};
+
+    serial_loopback_clear_stats();
+    for (int i = 0; i < requests; i++) {
+        EXPECT_TRUE(transaction_rpc_exec(RPC_ID_USER_INCREMENT, sizeof(request), request, sizeof(response), response));
+    }
+    const serial_loopback_stats_t single = *serial_loopback_get_stats();
+
+    serial_loopback_clear_stats();
+    for (int i = 0; i < requests; i += RPC_QUEUE_SIZE) {
+        for (int j = 1; j < RPC_QUEUE_SIZE; j++) {
+            EXPECT_TRUE(transaction_rpc_exec_async(RPC_ID_USER_INCREMENT, sizeof(request), request, sizeof(response), NULL, NULL));
+        }
+        EXPECT_TRUE(transaction_rpc_exec(RPC_ID_USER_INCREMENT, sizeof(request), request, sizeof(response), response));
+    }
+    const serial_loopback_stats_t *batched = serial_loopback_get_stats();
+
+    EXPECT_EQ(executions, 2 * requests);
+    EXPECT_EQ(single.transactions, 2 * requests);
+    EXPECT_EQ(batched->transactions, 2 * requests / RPC_QUEUE_SIZE);
+
+    RecordProperty("single_us_per_request", std::to_string((double)single.link_time_us / requests));
+    RecordProperty("batched_us_per_request", std::to_string((double)batched->link_time_us / requests));
+}
@@ -0,0 +1,169 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keycode.h"
+#include "../split_test_fixture.hpp"
+
+extern "C" {
+#include "serial_loopback.h"
+#include "split_util.h"
+#include "transactions.h"
+}
+
+using testing::_;
+
+static std::vector<uint8_t> received;
+static uint32_t             received_chunks = 0;
+static bool                 receiver_ready  = true;
+
+extern "C" bool split_stream_receive_user(uint8_t channel, uint32_t offset, uint32_t total_length, const uint8_t *data, uint8_t length) {
+    if (!receiver_ready) {
+        return false;
+    }
+    if (offset == 0) {
+        received.clear();
+    }
+    EXPECT_EQ(channel, 7);
+    EXPECT_EQ(offset, received.size());
+    received.insert(received.end(), data, data + length);
+    received_chunks++;
+    return true;
+}
+
+class SplitStream : public SplitTestFixture {
+   protected:
+    std::vector<uint8_t> payload;
+
+    void SetUp() override {
+        SplitTestFixture::SetUp();
+        received.clear();
+        received_chunks = 0;
+        receiver_ready  = true;
+
+        payload.resize(1000);
+        for (size_t i = 0; i < payload.size(); i++) {
+            payload[i] = (uint8_t)(i * 7 + 3);
+        }
+    }
+
+    void TearDown() override {
+        split_stream_abort();
+        SplitTestFixture::TearDown();
+    }
+
+    int scans_until_sent(int limit) {
+        int scans = 0;
+        while (is_split_stream_busy() && scans < limit) {
+            run_one_scan_loop();
+            scans++;
+        }
+        /* The last chunk is handed over by the slave on the following scan. */
+        run_one_scan_loop();
+        return scans;
+    }
+};
+
+TEST_F(SplitStream, BufferIsDeliveredInOrder) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    EXPECT_TRUE(split_stream_send(7, payload.data(), payload.size()));
+    EXPECT_FALSE(split_stream_send(7, payload.data(), payload.size()));
+
+    int scans = scans_until_sent(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(is_split_stream_busy());
+    EXPECT_EQ(scans, (payload.size() + SPLIT_STREAM_CHUNK_SIZE - 1) / SPLIT_STREAM_CHUNK_SIZE);
+    EXPECT_EQ(received, payload);
+    EXPECT_EQ(serial_loopback_get_stats()->failed_transactions, 0);
+}
+
+TEST_F(SplitStream, KeysAreNotDelayedByStream) {
+    TestDriver driver;
+    auto       slave_key = KeymapKey(0, 0, MATRIX_ROWS / 2, KC_A);
+
+    set_keymap({slave_key});
+
+    EXPECT_TRUE(split_stream_send(7, payload.data(), payload.size()));
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_A));
+    slave_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    slave_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(is_split_stream_busy());
+}
+
+TEST_F(SplitStream, BusyReceiverHoldsBackMaster) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    receiver_ready = false;
+    EXPECT_TRUE(split_stream_send(7, payload.data(), payload.size()));
+    for (int i = 0; i < 50; i++) {
+        run_one_scan_loop();
+    }
+    EXPECT_TRUE(is_split_stream_busy());
+    EXPECT_EQ(received_chunks, 0);
+
+    receiver_ready = true;
+    scans_until_sent(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(received, payload);
+}
+
+TEST_F(SplitStream, CorruptedChunksAreResent) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    serial_loopback_config_t config = serial_loopback_get_config();
+    config.bit_error_rate           = 1000;
+    set_link(config);
+
+    EXPECT_TRUE(split_stream_send(7, payload.data(), payload.size()));
+    scans_until_sent(5000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(serial_loopback_get_stats()->corrupted_bits, 0);
+    EXPECT_FALSE(is_split_stream_busy());
+    EXPECT_EQ(received, payload);
+}
+
+TEST_F(SplitStream, LostAcksDontDuplicateChunks) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    /* The slave takes the first chunk, but the master doesn't learn about it and sends it again. */
+    serial_loopback_drop_responses(PUT_STREAM_CHUNK, 1);
+    EXPECT_TRUE(split_stream_send(7, payload.data(), payload.size()));
+    scans_until_sent(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(serial_loopback_get_stats()->failed_transactions, 1);
+    EXPECT_FALSE(is_split_stream_busy());
+    EXPECT_EQ(received_chunks, (payload.size() + SPLIT_STREAM_CHUNK_SIZE - 1) / SPLIT_STREAM_CHUNK_SIZE);
+    EXPECT_EQ(received, payload);
+}
+
+TEST_F(SplitStream, LinkCostPerScan) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    EXPECT_TRUE(split_stream_send(7, payload.data(), payload.size()));
+    serial_loopback_clear_stats();
+    int scans = scans_until_sent(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    RecordProperty("stream_bytes_per_scan", std::to_string((double)payload.size() / scans));
+    record_link_cost(scans);
+}
@@ -0,0 +1,98 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "../split_test_fixture.hpp"
+
+extern "C" {
+#include "serial_loopback.h"
+#include "transport.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class SplitSyncState : public SplitTestFixture {};
+
+TEST_F(SplitSyncState, ModsAreSentOnChange) {
+    TestDriver driver;
+    auto       shift_key = KeymapKey(0, 0, 0, KC_LSFT);
+
+    set_keymap({shift_key});
+
+    /* State is sent to the slave during the matrix scan following the change. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    shift_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    serial_loopback_clear_stats();
+    run_one_scan_loop();
+    EXPECT_GE(serial_loopback_get_stats()->bytes_to_slave, sizeof(split_mods_sync_t));
+    EXPECT_EQ(serial_loopback_get_slave_memory()->mods.real_mods, MOD_BIT(KC_LSFT));
+
+    EXPECT_EMPTY_REPORT(driver);
+    shift_key.release();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(serial_loopback_get_slave_memory()->mods.real_mods, 0);
+}
+
+TEST_F(SplitSyncState, LayerChangeIsSent) {
+    TestDriver driver;
+    auto       layer_key = KeymapKey(0, 0, 0, MO(1));
+    auto       slave_key = KeymapKey(1, 0, MATRIX_ROWS / 2, KC_B);
+
+    set_keymap({layer_key, slave_key, KeymapKey(0, 0, MATRIX_ROWS / 2, KC_A)});
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    serial_loopback_clear_stats();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_GE(serial_loopback_get_stats()->bytes_to_slave, sizeof(layer_state_t));
+    EXPECT_EQ(serial_loopback_get_slave_memory()->layers.layer_state, layer_state);
+
+    EXPECT_REPORT(driver, (KC_B));
+    slave_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    slave_key.release();
+    run_one_scan_loop();
+    layer_key.release();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(serial_loopback_get_slave_memory()->layers.layer_state, 0);
+}
+
+TEST_F(SplitSyncState, MasterMatrixIsMirrored) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 4, 1, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(serial_loopback_get_slave_memory()->mmatrix.matrix[1], 1 << 4);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(serial_loopback_get_slave_memory()->mmatrix.matrix[1], 0);
+}
+
+TEST_F(SplitSyncState, LinkCostPerScan) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    measure_idle_link_cost(1000);
+    VERIFY_AND_CLEAR(driver);
+}
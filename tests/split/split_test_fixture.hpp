@@ -0,0 +1,57 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include "test_common.hpp"
+
+extern "C" {
+#include "serial_loopback.h"
+}
+
+/**
+ * @brief Common fixture for the split transport tests.
+ *
+ * Starts every test with a healthy, zeroed loopback link and offers helpers to
+ * degrade the link and to report its cost.
+ */
+class SplitTestFixture : public TestFixture {
+   protected:
+    void SetUp() override {
+        serial_loopback_reset();
+    }
+
+    void TearDown() override {
+        serial_loopback_reset();
+    }
+
+    void set_link(serial_loopback_config_t config) {
+        serial_loopback_set_config(&config);
+    }
+
+    /**
+     * @brief Records the link statistics gathered since the last
+     * `serial_loopback_clear_stats()` as per-scan test properties.
+     */
+    void record_link_cost(int scans) {
+        const serial_loopback_stats_t *stats = serial_loopback_get_stats();
+
+        RecordProperty("transactions_per_scan", std::to_string((double)stats->transactions / scans));
+        RecordProperty("bytes_per_scan", std::to_string((double)(stats->bytes_to_slave + stats->bytes_to_master) / scans));
+        RecordProperty("link_us_per_scan", std::to_string((double)stats->link_time_us / scans));
+    }
+
+    /**
+     * @brief Runs `scans` idle scans and records what the link costs per scan.
+     */
+    void measure_idle_link_cost(int scans) {
+        serial_loopback_clear_stats();
+        for (int i = 0; i < scans; i++) {
+            run_one_scan_loop();
+        }
+
+        EXPECT_EQ(serial_loopback_get_stats()->failed_transactions, 0);
+        record_link_cost(scans);
+    }
+};
@@ -0,0 +1,136 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "split_test_fixture.hpp"
+
+extern "C" {
+#include "serial_loopback.h"
+#include "split_util.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class SplitTransport : public SplitTestFixture {};
+
+TEST_F(SplitTransport, SlaveKeyIsReportedByMaster) {
+    TestDriver driver;
+    auto       master_key = KeymapKey(0, 0, 0, KC_A);
+    auto       slave_key  = KeymapKey(0, 0, MATRIX_ROWS / 2, KC_B);
+
+    set_keymap({master_key, slave_key});
+
+    EXPECT_REPORT(driver, (KC_B));
+    slave_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    master_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    slave_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    master_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(serial_loopback_get_stats()->failed_transactions, 0);
+}
+
+TEST_F(SplitTransport, SlaveKeysAreReleasedOnDisconnect) {
+    TestDriver driver;
+    auto       slave_key = KeymapKey(0, 1, MATRIX_ROWS - 1, KC_C);
+
+    set_keymap({slave_key});
+
+    EXPECT_REPORT(driver, (KC_C));
+    slave_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    serial_loopback_config_t config = serial_loopback_get_config();
+    config.connected                = false;
+    set_link(config);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(is_transport_connected());
+
+    /* Further attempts are throttled while disconnected. */
+    serial_loopback_clear_stats();
+    idle_for(100);
+    EXPECT_EQ(serial_loopback_get_stats()->transactions, 0);
+
+    slave_key.release();
+    config.connected = true;
+    set_link(config);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(1000);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(is_transport_connected());
+}
+
+TEST_F(SplitTransport, ParityErrorsAreRetried) {
+    TestDriver driver;
+    auto       slave_key = KeymapKey(0, 2, MATRIX_ROWS / 2, KC_D);
+
+    set_keymap({slave_key});
+
+    serial_loopback_config_t config = serial_loopback_get_config();
+    config.bit_error_rate           = 5000;
+    config.parity                   = true;
+    set_link(config);
+
+    EXPECT_REPORT(driver, (KC_D));
+    slave_key.press();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    slave_key.release();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(serial_loopback_get_stats()->failed_transactions, 0);
+    EXPECT_TRUE(is_transport_connected());
+}
+
+TEST_F(SplitTransport, CorruptedMatrixIsRejectedByChecksum) {
+    TestDriver driver;
+    auto       slave_key = KeymapKey(0, 3, MATRIX_ROWS / 2, KC_E);
+
+    set_keymap({slave_key});
+
+    serial_loopback_config_t config = serial_loopback_get_config();
+    config.bit_error_rate           = 20000;
+    set_link(config);
+
+    /* Without parity corrupted bytes make it across, only the matrix checksum
+     * keeps them from turning into phantom key presses. */
+    EXPECT_REPORT(driver, (KC_E)).Times(1);
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    slave_key.press();
+    idle_for(100);
+    slave_key.release();
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(serial_loopback_get_stats()->corrupted_bits, 0);
+}
+
+TEST_F(SplitTransport, LinkCostPerScan) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    measure_idle_link_cost(1000);
+    VERIFY_AND_CLEAR(driver);
+}
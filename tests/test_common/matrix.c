@@ -20,17 +20,49 @@
 
 static matrix_row_t matrix[MATRIX_ROWS] = {};
 
+#ifdef SPLIT_KEYBOARD
+#    include "split_util.h"
+#    include "transport.h"
+#    include "serial_loopback.h"
+
+#    define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+/* The test process is always the left master half, the right half is simulated
+ * behind the loopback transport. Rows of the slave half only become visible
+ * once they went over the link. */
+static matrix_row_t slave_rows[ROWS_PER_HAND] = {};
+
+static void split_matrix_exchange(void) {
+    serial_loopback_slave_task(matrix + ROWS_PER_HAND);
+
+    matrix_row_t received_rows[ROWS_PER_HAND] = {};
+    if (transport_master_if_connected(matrix, received_rows)) {
+        memcpy(slave_rows, received_rows, sizeof(slave_rows));
+    } else {
+        memset(slave_rows, 0, sizeof(slave_rows));
+    }
+}
+#endif
+
 void matrix_init(void) {
     clear_all_keys();
     matrix_init_kb();
 }
 
 uint8_t matrix_scan(void) {
+#ifdef SPLIT_KEYBOARD
+    split_matrix_exchange();
+#endif
     matrix_scan_kb();
     return 1;
 }
 
 matrix_row_t matrix_get_row(uint8_t row) {
+#ifdef SPLIT_KEYBOARD
+    if (row >= ROWS_PER_HAND) {
+        return slave_rows[row - ROWS_PER_HAND];
+    }
+#endif
     return matrix[row];
 }
 
@@ -15,7 +15,6 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#define FLUSH_TIMEOUT 5000
 #define EECONFIG_MD_LED ((uint8_t*)(EECONFIG_SIZE + 64))
 #define MD_LED_CONFIG_VERSION 1
 
@@ -59,11 +58,6 @@ void md_led_changed(void) {
     eeconfig_flag_md_led(true);
 }
 
-// todo: use real task rather than this bodge
-void housekeeping_task_kb(void) {
-    eeconfig_flush_md_led_task(FLUSH_TIMEOUT);
-}
-
 __attribute__((weak)) led_instruction_t led_instructions[] = {{.end = 1}};
 static void                             md_rgb_matrix_config_override(int i);
 #    else
@@ -85,6 +85,7 @@ void host_keyboard_send(report_keyboard_t *report) {
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
     (*driver->send_keyboard)(report);
+    keyboard_boot_phase_mark(BOOT_PHASE_FIRST_REPORT);
 
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
@@ -99,6 +100,7 @@ void host_nkro_send(report_nkro_t *report) {
     if (!driver) return;
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
+    keyboard_boot_phase_mark(BOOT_PHASE_FIRST_REPORT);
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);